@@ -0,0 +1,301 @@
+/*******************************************************************************************
+*
+*   rres benchmark - DEFLATE decompression: bundled inflate vs raylib DecompressData()
+*
+*   This benchmark measures UnpackResourceChunk() for a chunk compressed with DEFLATE (RRES_COMP_DEFLATE),
+*   decompressed by the bundled inflate decoder (default DEFLATE codec, decoding directly into the final buffer)
+*   and by raylib DecompressData() (registered as DEFLATE codec with SetCompressionCodec(), it returns a
+*   new buffer, copied into the final buffer for data compressed in blocks)
+*
+*   Payload is generated data with a compression ratio similar to usual game assets, or a provided file,
+*   compressed as one stream and in independent blocks (RRES_FLAG_COMP_BLOCKS), unpacked in one thread.
+*   Reported (JSON): unpack throughput (MB/s) for every decoder and speedup of bundled inflate
+*
+*   USAGE:
+*       rres_bench_inflate [options]
+*           --file <file>           Payload file (default: generated data)
+*           --size <bytes>          Generated data size (default: 33554432)
+*           --block-size <bytes>    Compression block size (default: 131072)
+*           --iterations <count>    Unpack iterations per decoder (default: 5)
+*           --output <file.json>    Results output file (default: stdout)
+*
+*   NOTE: It runs headless, no window or audio device is initialized, time is measured with rresGetTimeNs()
+*
+*   This benchmark has been created using rres 1.0 (github.com/raysan5/rres)
+*   This benchmark uses raylib 4.1-dev (www.raylib.com) to load resources data
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2022-2024 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>                      // Required for: printf(), fprintf(), fopen()
+#include <stdlib.h>                     // Required for: strtoul()
+#include <string.h>                     // Required for: strcmp(), memcmp(), memcpy()
+
+#define RRES_LOG(...)           ((void)0)   // Avoid log messages, they would be measured
+#define RRES_SUPPORT_STATS                  // Required to measure time with rresGetTimeNs()
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#include "../src/rres-raylib.h"       // Required to pack/unpack rres data chunks
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static rresResourceChunk LoadChunkFromData(const unsigned char *data, unsigned int size); // Load unpacked chunk from data (RAWD)
+static rresResourceChunk CopyChunk(rresResourceChunk chunk);        // Copy packed resource chunk, including data
+static void GenerateData(unsigned char *data, unsigned int size);   // Generate data with a compression ratio similar to game assets
+static unsigned char *CompressDataRaylib(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned int *compSize); // Compression codec: DEFLATE (raylib)
+static unsigned char *DecompressDataRaylib(const unsigned char *data, unsigned int size, unsigned int *dataSize); // Compression codec: DEFLATE (raylib)
+static double MeasureUnpack(rresResourceChunk packed, const unsigned char *data, unsigned int size, unsigned int iterations, double *minTime, int *errors); // Measure unpack time (mean)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const char *fileName = NULL;
+    const char *outputFileName = NULL;
+    unsigned int dataSize = 32*1024*1024;
+    unsigned int blockSize = 128*1024;
+    unsigned int iterations = 5;
+
+    // Parse command-line options
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--file") == 0) && (i + 1 < argc)) fileName = argv[++i];
+        else if ((strcmp(argv[i], "--size") == 0) && (i + 1 < argc)) dataSize = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--block-size") == 0) && (i + 1 < argc)) blockSize = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--iterations") == 0) && (i + 1 < argc)) iterations = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc)) outputFileName = argv[++i];
+        else { fprintf(stderr, "BENCH: Unknown option: %s\n", argv[i]); return 1; }
+    }
+
+    if (iterations < 1) iterations = 1;
+    if (dataSize < 1) dataSize = 1;
+    if (blockSize < 1) blockSize = 1;
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetUnpackThreadCount(1);
+
+    // Load payload
+    //----------------------------------------------------------------------------------
+    unsigned char *data = NULL;
+
+    if (fileName != NULL)
+    {
+        int fileSize = 0;
+        data = LoadFileData(fileName, &fileSize);
+        if (data == NULL) { fprintf(stderr, "BENCH: Payload file could not be loaded\n"); return 1; }
+        dataSize = (unsigned int)fileSize;
+    }
+    else
+    {
+        data = (unsigned char *)RL_MALLOC(dataSize);
+        GenerateData(data, dataSize);
+    }
+
+    rresResourceChunk chunk = LoadChunkFromData(data, dataSize);
+
+    // Pack payload: compressed as one stream and compressed in blocks
+    rresResourceChunk packedStream = CopyChunk(chunk);
+    SetCompressionBlockSize(0);
+    int packResult = PackResourceChunk(&packedStream, RRES_COMP_DEFLATE, RRES_CIPHER_NONE);
+
+    rresResourceChunk packedBlocks = CopyChunk(chunk);
+    SetCompressionBlockSize(blockSize);
+    if (packResult == 0) packResult = PackResourceChunk(&packedBlocks, RRES_COMP_DEFLATE, RRES_CIPHER_NONE);
+
+    if (packResult != 0) { fprintf(stderr, "BENCH: Payload could not be packed: %i\n", packResult); return 1; }
+    //----------------------------------------------------------------------------------
+
+    FILE *output = stdout;
+    if (outputFileName != NULL) output = fopen(outputFileName, "wt");
+    if (output == NULL) { fprintf(stderr, "BENCH: Output file could not be opened\n"); return 1; }
+
+    // Measure bundled inflate (default DEFLATE codec) and raylib DecompressData()
+    // NOTE: Times: [decoder][layout], layout: 0 - one stream, 1 - blocks
+    double times[2][2] = { 0 };
+    double minTimes[2][2] = { 0 };
+    int errors[2][2] = { 0 };
+
+    for (int decoder = 0; decoder < 2; decoder++)
+    {
+        if (decoder == 1) SetCompressionCodec(RRES_COMP_DEFLATE, (CompressionCodec){ .name = "DEFLATE (raylib)", .compress = CompressDataRaylib, .decompress = DecompressDataRaylib, .blocks = true });
+
+        times[decoder][0] = MeasureUnpack(packedStream, data, dataSize, iterations, &minTimes[decoder][0], &errors[decoder][0]);
+        times[decoder][1] = MeasureUnpack(packedBlocks, data, dataSize, iterations, &minTimes[decoder][1], &errors[decoder][1]);
+    }
+
+    fprintf(output, "{\n  \"benchmark\": \"rres_bench_inflate\",\n  \"payload\": \"%s\",\n  \"iterations\": %u,\n",
+        (fileName != NULL)? fileName : "generated", iterations);
+    fprintf(output, "  \"baseSize\": %u,\n  \"blockSize\": %u,\n  \"streamPackedSize\": %u,\n  \"blocksPackedSize\": %u,\n  \"results\": [\n",
+        packedStream.info.baseSize, blockSize, packedStream.info.packedSize, packedBlocks.info.packedSize);
+
+    for (int layout = 0; layout < 2; layout++)
+    {
+        fprintf(output, "    { \"layout\": \"%s\", \"inflateMBs\": %.2f, \"inflateMaxMBs\": %.2f, \"raylibMBs\": %.2f, \"raylibMaxMBs\": %.2f, \"speedup\": %.2f, \"errors\": %i }%s\n",
+            (layout == 0)? "stream" : "blocks", dataSize/times[0][layout]/1000000.0, dataSize/minTimes[0][layout]/1000000.0,
+            dataSize/times[1][layout]/1000000.0, dataSize/minTimes[1][layout]/1000000.0, minTimes[1][layout]/minTimes[0][layout],
+            errors[0][layout] + errors[1][layout], (layout == 0)? "," : "");
+    }
+
+    fprintf(output, "  ]\n}\n");
+
+    if (output != stdout) fclose(output);
+
+    rresUnloadResourceChunk(packedBlocks);
+    rresUnloadResourceChunk(packedStream);
+    rresUnloadResourceChunk(chunk);
+    RL_FREE(data);
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load unpacked resource chunk from data (RAWD)
+static rresResourceChunk LoadChunkFromData(const unsigned char *data, unsigned int size)
+{
+    rresResourceChunk chunk = { 0 };
+
+    memcpy(chunk.info.type, "RAWD", 4);
+    chunk.info.id = 0x00000001;
+    chunk.info.baseSize = sizeof(int) + 4*sizeof(int) + size;
+    chunk.info.packedSize = chunk.info.baseSize;
+
+    chunk.data.propCount = 4;
+    chunk.data.props = (unsigned int *)RRES_CALLOC(4, sizeof(int));
+    chunk.data.props[0] = size;
+    chunk.data.props[1] = 0x2e62696e;   // Extension: ".bin"
+    chunk.data.raw = RRES_MALLOC(size);
+    memcpy(chunk.data.raw, data, size);
+
+    return chunk;
+}
+
+// Copy resource chunk, including data
+// NOTE: Unpacked chunks keep props separated, packed chunks only contain data
+static rresResourceChunk CopyChunk(rresResourceChunk chunk)
+{
+    rresResourceChunk copy = chunk;
+    unsigned int rawSize = (chunk.data.props == NULL)? chunk.info.packedSize : (chunk.info.baseSize - sizeof(int) - chunk.data.propCount*sizeof(int));
+
+    if (chunk.data.propCount > 0)
+    {
+        copy.data.props = (unsigned int *)RRES_CALLOC(chunk.data.propCount, sizeof(int));
+        memcpy(copy.data.props, chunk.data.props, chunk.data.propCount*sizeof(int));
+    }
+
+    copy.data.raw = RRES_MALLOC(rawSize);
+    memcpy(copy.data.raw, chunk.data.raw, rawSize);
+
+    return copy;
+}
+
+// Generate data with a compression ratio similar to game assets
+// NOTE: Sequences of repeated previous data (matches) mixed with random literals
+static void GenerateData(unsigned char *data, unsigned int size)
+{
+    unsigned int seed = 0x12345678;
+    unsigned int i = 0;
+
+    while (i < size)
+    {
+        seed = seed*1664525 + 1013904223;   // LCG, fast enough for large data
+
+        unsigned int length = 4 + ((seed >> 8) & 31);
+        if ((length + i) > size) length = size - i;
+
+        if (((seed >> 16) & 1) && (i > 1024))
+        {
+            // Match: copy previous data
+            unsigned int distance = 1 + ((seed >> 20) & 1023);
+            for (unsigned int j = 0; j < length; j++, i++) data[i] = data[i - distance];
+        }
+        else
+        {
+            // Literals: random data
+            for (unsigned int j = 0; j < length; j++, i++)
+            {
+                seed = seed*1664525 + 1013904223;
+                data[i] = (unsigned char)(seed >> 24);
+            }
+        }
+    }
+}
+
+// Compression codec: DEFLATE, compress data (raylib)
+static unsigned char *CompressDataRaylib(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned int *compSize)
+{
+    (void)dictionary; (void)dictionarySize;     // Dictionary not supported
+
+    int deflateSize = 0;
+    unsigned char *compData = CompressData(data, size, &deflateSize);
+
+    *compSize = (deflateSize > 0)? (unsigned int)deflateSize : 0;
+
+    return compData;
+}
+
+// Compression codec: DEFLATE, decompress data (raylib)
+static unsigned char *DecompressDataRaylib(const unsigned char *data, unsigned int size, unsigned int *dataSize)
+{
+    int inflateSize = 0;
+    unsigned char *output = DecompressData(data, size, &inflateSize);
+
+    *dataSize = (inflateSize > 0)? (unsigned int)inflateSize : 0;
+
+    return output;
+}
+
+// Measure unpack time, returns mean time (seconds)
+// NOTE: Unpacked data is validated against original data on every iteration
+static double MeasureUnpack(rresResourceChunk packed, const unsigned char *data, unsigned int size, unsigned int iterations, double *minTime, int *errors)
+{
+    double totalTime = 0.0;
+
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        rresResourceChunk chunk = CopyChunk(packed);
+
+        unsigned long long start = rresGetTimeNs();
+        int result = UnpackResourceChunk(&chunk);
+        double time = (double)(rresGetTimeNs() - start)/1000000000.0;
+
+        totalTime += time;
+        if ((i == 0) || (time < *minTime)) *minTime = time;
+
+        if ((result != 0) || (memcmp(chunk.data.raw, data, size) != 0)) (*errors)++;
+
+        rresUnloadResourceChunk(chunk);
+    }
+
+    return totalTime/iterations;
+}
@@ -0,0 +1,544 @@
+/*******************************************************************************************
+*
+*   rres benchmark - core reader
+*
+*   This benchmark generates a synthetic rres file and measures rres.h reader functions:
+*     - rresLoadResourceChunk() latency by chunk position in file
+*     - rresLoadResourceChunkInfoAll() time
+*     - rresLoadCentralDirectory() time and memory
+*     - rresGetResourceId() latency
+*
+*   Results are written as JSON, to track reader improvements/regressions
+*
+*   USAGE:
+*       rres_bench_reader [options]
+*           --chunks <count>        Number of resource chunks to generate [1..65535] (default: 1024)
+*           --size <min>:<max>      Chunk data size range in bytes (default: 256:65536)
+*           --dist <distribution>   Chunk data size distribution: fixed, uniform, log (default: uniform)
+*           --cdir <0|1>            Generate central directory (default: 1)
+*           --iterations <count>    Iterations per measurement (default: 20)
+*           --seed <value>          Random seed for generated data (default: 1)
+*           --file <file.rres>      Generated rres file (default: rres_bench_reader.rres)
+*           --output <file.json>    Results output file (default: stdout)
+*
+*   This benchmark has been created using rres 1.0 (github.com/raysan5/rres)
+*   It does not require raylib, only rres.h is used
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2022-2024 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200112L     // Required for: clock_gettime()
+#endif
+
+#include <stdio.h>                      // Required for: printf(), fprintf(), fopen(), fwrite()
+#include <stdlib.h>                     // Required for: malloc(), free(), atoi(), strtoul()
+#include <string.h>                     // Required for: strcmp(), memset(), snprintf()
+#include <time.h>                       // Required for: clock_gettime()
+
+#if defined(_WIN32)
+    // Functions required to query time on Windows
+    // NOTE: Declared here to avoid including windows.h
+    __declspec(dllimport) int __stdcall QueryPerformanceCounter(unsigned long long int *lpPerformanceCount);
+    __declspec(dllimport) int __stdcall QueryPerformanceFrequency(unsigned long long int *lpFrequency);
+#endif
+
+// Track rres.h memory allocations to measure memory usage
+// NOTE: RRES_REALLOC() is not used by rres.h reader functions
+#define RRES_MALLOC(sz)         BenchMalloc(sz)
+#define RRES_CALLOC(n,sz)       BenchCalloc(n,sz)
+#define RRES_FREE(ptr)          BenchFree(ptr)
+
+#define RRES_LOG(...)           ((void)0)   // Avoid log messages, they would be measured
+
+static void *BenchMalloc(size_t size);
+static void *BenchCalloc(size_t count, size_t size);
+static void BenchFree(void *ptr);
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to read rres data chunks
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define BENCH_POSITIONS_COUNT      9    // Number of chunk positions measured for rresLoadResourceChunk()
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Chunk data size distribution
+typedef enum {
+    DIST_FIXED = 0,                     // All chunks use min size
+    DIST_UNIFORM,                       // Sizes uniformly distributed in [min..max]
+    DIST_LOG                            // Sizes log-uniformly distributed in [min..max], more small chunks
+} SizeDistribution;
+
+// Benchmark configuration
+typedef struct {
+    unsigned int chunkCount;            // Number of resource chunks
+    unsigned int sizeMin;               // Chunk data min size
+    unsigned int sizeMax;               // Chunk data max size
+    int distribution;                   // Chunk data size distribution
+    int cdir;                           // Generate central directory
+    unsigned int iterations;            // Iterations per measurement
+    unsigned int seed;                  // Random seed
+    const char *fileName;               // Generated rres file
+    const char *outputFileName;         // Results output file
+} BenchConfig;
+
+// Timing measurement
+typedef struct {
+    unsigned long long total;           // Total time (nanoseconds)
+    unsigned long long min;             // Min time (nanoseconds)
+    unsigned long long max;             // Max time (nanoseconds)
+    unsigned int count;                 // Number of samples
+} BenchTiming;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static unsigned long long memUsed = 0;  // Memory currently allocated by rres.h
+static unsigned long long memPeak = 0;  // Memory peak allocated by rres.h
+static unsigned int randState = 1;      // Random generator state
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static unsigned long long GetTimeNs(void);                          // Get current time in nanoseconds
+static unsigned int GetRandom(void);                                // Get random value (xorshift32)
+static void AddTiming(BenchTiming *timing, unsigned long long time); // Add time sample to timing
+static void WriteTiming(FILE *output, BenchTiming timing);          // Write timing as JSON members
+static unsigned int GetChunkSize(BenchConfig config);               // Get chunk data size for configured distribution
+static void GetChunkFileName(unsigned int index, char *fileName);   // Get chunk source fileName (synthetic)
+static unsigned int *GenerateFile(BenchConfig config);              // Generate synthetic rres file, returns chunks ids
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    BenchConfig config = {
+        .chunkCount = 1024,
+        .sizeMin = 256,
+        .sizeMax = 65536,
+        .distribution = DIST_UNIFORM,
+        .cdir = 1,
+        .iterations = 20,
+        .seed = 1,
+        .fileName = "rres_bench_reader.rres",
+        .outputFileName = NULL
+    };
+
+    // Parse command-line options
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--chunks") == 0) && (i + 1 < argc)) config.chunkCount = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--size") == 0) && (i + 1 < argc))
+        {
+            char *next = NULL;
+            config.sizeMin = (unsigned int)strtoul(argv[++i], &next, 10);
+            config.sizeMax = (*next == ':')? (unsigned int)strtoul(next + 1, NULL, 10) : config.sizeMin;
+        }
+        else if ((strcmp(argv[i], "--dist") == 0) && (i + 1 < argc))
+        {
+            i++;
+            if (strcmp(argv[i], "fixed") == 0) config.distribution = DIST_FIXED;
+            else if (strcmp(argv[i], "uniform") == 0) config.distribution = DIST_UNIFORM;
+            else if (strcmp(argv[i], "log") == 0) config.distribution = DIST_LOG;
+            else { fprintf(stderr, "BENCH: Unknown size distribution: %s\n", argv[i]); return 1; }
+        }
+        else if ((strcmp(argv[i], "--cdir") == 0) && (i + 1 < argc)) config.cdir = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--iterations") == 0) && (i + 1 < argc)) config.iterations = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--seed") == 0) && (i + 1 < argc)) config.seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--file") == 0) && (i + 1 < argc)) config.fileName = argv[++i];
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc)) config.outputFileName = argv[++i];
+        else { fprintf(stderr, "BENCH: Unknown option: %s\n", argv[i]); return 1; }
+    }
+
+    // NOTE: Chunks count is limited by rresFileHeader.chunkCount, including the CDIR chunk
+    if ((config.chunkCount < 1) || (config.chunkCount > (config.cdir? 65534u : 65535u))) { fprintf(stderr, "BENCH: Chunks count out of range\n"); return 1; }
+    if ((config.sizeMin < 1) || (config.sizeMax < config.sizeMin)) { fprintf(stderr, "BENCH: Chunk size range not valid\n"); return 1; }
+    if (config.iterations < 1) config.iterations = 1;
+
+    randState = (config.seed != 0)? config.seed : 1;
+
+    // Generate synthetic rres file
+    unsigned int *ids = GenerateFile(config);
+    if (ids == NULL) { fprintf(stderr, "BENCH: rres file could not be generated\n"); return 1; }
+
+    FILE *output = stdout;
+    if (config.outputFileName != NULL) output = fopen(config.outputFileName, "wt");
+    if (output == NULL) { fprintf(stderr, "BENCH: Output file could not be opened\n"); free(ids); return 1; }
+
+    FILE *rresFile = fopen(config.fileName, "rb");
+    fseek(rresFile, 0, SEEK_END);
+    long fileSize = ftell(rresFile);
+    fclose(rresFile);
+
+    const char *distNames[3] = { "fixed", "uniform", "log" };
+
+    fprintf(output, "{\n  \"benchmark\": \"rres_bench_reader\",\n");
+    fprintf(output, "  \"config\": { \"chunks\": %u, \"sizeMin\": %u, \"sizeMax\": %u, \"distribution\": \"%s\", \"cdir\": %s, \"iterations\": %u, \"seed\": %u, \"fileSize\": %li },\n",
+        config.chunkCount, config.sizeMin, config.sizeMax, distNames[config.distribution], config.cdir? "true" : "false", config.iterations, config.seed, fileSize);
+
+    // Benchmark: rresLoadResourceChunk() latency by chunk position
+    // NOTE: Chunks are found scanning the file from the beginning, latency depends on position
+    //----------------------------------------------------------------------------------
+    unsigned int positionCount = (config.chunkCount < BENCH_POSITIONS_COUNT)? config.chunkCount : BENCH_POSITIONS_COUNT;
+
+    fprintf(output, "  \"loadResourceChunk\": [\n");
+
+    for (unsigned int p = 0; p < positionCount; p++)
+    {
+        unsigned int position = (positionCount > 1)? (unsigned int)((unsigned long long)(config.chunkCount - 1)*p/(positionCount - 1)) : 0;
+        BenchTiming timing = { 0 };
+
+        for (unsigned int i = 0; i < config.iterations; i++)
+        {
+            unsigned long long time = GetTimeNs();
+            rresResourceChunk chunk = rresLoadResourceChunk(config.fileName, ids[position]);
+            AddTiming(&timing, GetTimeNs() - time);
+
+            if (chunk.data.raw == NULL) fprintf(stderr, "BENCH: WARNING: Chunk at position %u could not be loaded\n", position);
+            rresUnloadResourceChunk(chunk);
+        }
+
+        fprintf(output, "    { \"position\": %u, \"id\": \"0x%08x\", ", position, ids[position]);
+        WriteTiming(output, timing);
+        fprintf(output, " }%s\n", (p < positionCount - 1)? "," : "");
+    }
+
+    fprintf(output, "  ],\n");
+    //----------------------------------------------------------------------------------
+
+    // Benchmark: rresLoadResourceChunkInfoAll() time
+    //----------------------------------------------------------------------------------
+    BenchTiming infoTiming = { 0 };
+    unsigned long long infoBytes = 0;
+
+    for (unsigned int i = 0; i < config.iterations; i++)
+    {
+        unsigned int count = 0;
+
+        unsigned long long time = GetTimeNs();
+        rresResourceChunkInfo *infos = rresLoadResourceChunkInfoAll(config.fileName, &count);
+        AddTiming(&infoTiming, GetTimeNs() - time);
+
+        infoBytes = memUsed;
+        RRES_FREE(infos);
+    }
+
+    fprintf(output, "  \"loadResourceChunkInfoAll\": { ");
+    WriteTiming(output, infoTiming);
+    fprintf(output, ", \"retainedBytes\": %llu },\n", infoBytes);
+    //----------------------------------------------------------------------------------
+
+    // Benchmark: rresLoadCentralDirectory() time and memory, rresGetResourceId() latency
+    //----------------------------------------------------------------------------------
+    if (config.cdir)
+    {
+        BenchTiming dirTiming = { 0 };
+        unsigned long long dirPeak = 0;
+        unsigned long long dirRetained = 0;
+
+        for (unsigned int i = 0; i < config.iterations; i++)
+        {
+            memPeak = memUsed;
+
+            unsigned long long time = GetTimeNs();
+            rresCentralDir dir = rresLoadCentralDirectory(config.fileName);
+            AddTiming(&dirTiming, GetTimeNs() - time);
+
+            dirPeak = memPeak;
+            dirRetained = memUsed;
+            rresUnloadCentralDirectory(dir);
+        }
+
+        fprintf(output, "  \"loadCentralDirectory\": { ");
+        WriteTiming(output, dirTiming);
+        fprintf(output, ", \"peakBytes\": %llu, \"retainedBytes\": %llu },\n", dirPeak, dirRetained);
+
+        // Lookup all available fileNames in central directory
+        rresCentralDir dir = rresLoadCentralDirectory(config.fileName);
+        BenchTiming idTiming = { 0 };
+        BenchTiming missTiming = { 0 };
+        char fileName[64] = { 0 };
+        unsigned int errors = 0;
+
+        for (unsigned int i = 0; i < config.iterations; i++)
+        {
+            for (unsigned int k = 0; k < config.chunkCount; k++)
+            {
+                GetChunkFileName(k, fileName);
+
+                unsigned long long time = GetTimeNs();
+                unsigned int id = rresGetResourceId(dir, fileName);
+                AddTiming(&idTiming, GetTimeNs() - time);
+
+                if (id != ids[k]) errors++;
+            }
+
+            // Lookup for a fileName not available, worst case
+            unsigned long long time = GetTimeNs();
+            unsigned int id = rresGetResourceId(dir, "resources/not_available.dat");
+            AddTiming(&missTiming, GetTimeNs() - time);
+
+            if (id != 0) errors++;
+        }
+
+        rresUnloadCentralDirectory(dir);
+
+        fprintf(output, "  \"getResourceId\": { ");
+        WriteTiming(output, idTiming);
+        fprintf(output, ", \"errors\": %u, \"miss\": { ", errors);
+        WriteTiming(output, missTiming);
+        fprintf(output, " } }\n");
+    }
+    else fprintf(output, "  \"loadCentralDirectory\": null,\n  \"getResourceId\": null\n");
+    //----------------------------------------------------------------------------------
+
+    fprintf(output, "}\n");
+
+    if (output != stdout) fclose(output);
+    free(ids);
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Memory allocators, tracking allocated size
+// NOTE: Allocation size is stored before returned pointer, keeping 16-byte alignment
+static void *BenchMalloc(size_t size)
+{
+    unsigned char *ptr = (unsigned char *)malloc(size + 16);
+    if (ptr == NULL) return NULL;
+
+    *((size_t *)ptr) = size;
+    memUsed += size;
+    if (memUsed > memPeak) memPeak = memUsed;
+
+    return ptr + 16;
+}
+
+static void *BenchCalloc(size_t count, size_t size)
+{
+    void *ptr = BenchMalloc(count*size);
+    if (ptr != NULL) memset(ptr, 0, count*size);
+
+    return ptr;
+}
+
+static void BenchFree(void *ptr)
+{
+    if (ptr == NULL) return;
+
+    memUsed -= *((size_t *)((unsigned char *)ptr - 16));
+    free((unsigned char *)ptr - 16);
+}
+
+// Get current time in nanoseconds
+static unsigned long long GetTimeNs(void)
+{
+#if defined(_WIN32)
+    unsigned long long int frequency = 0;
+    unsigned long long int counter = 0;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (unsigned long long)((double)counter*1000000000.0/(double)frequency);
+#else
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec*1000000000ULL + (unsigned long long)now.tv_nsec;
+#endif
+}
+
+// Get random value (xorshift32)
+static unsigned int GetRandom(void)
+{
+    randState ^= randState << 13;
+    randState ^= randState >> 17;
+    randState ^= randState << 5;
+
+    return randState;
+}
+
+// Add time sample to timing
+static void AddTiming(BenchTiming *timing, unsigned long long time)
+{
+    if ((timing->count == 0) || (time < timing->min)) timing->min = time;
+    if (time > timing->max) timing->max = time;
+    timing->total += time;
+    timing->count++;
+}
+
+// Write timing as JSON members
+static void WriteTiming(FILE *output, BenchTiming timing)
+{
+    fprintf(output, "\"samples\": %u, \"meanNs\": %.1f, \"minNs\": %llu, \"maxNs\": %llu",
+        timing.count, (timing.count > 0)? (double)timing.total/timing.count : 0.0, timing.min, timing.max);
+}
+
+// Get chunk data size for configured distribution
+static unsigned int GetChunkSize(BenchConfig config)
+{
+    unsigned int size = config.sizeMin;
+    unsigned int range = config.sizeMax - config.sizeMin;
+
+    switch (config.distribution)
+    {
+        case DIST_UNIFORM: if (range > 0) size = config.sizeMin + GetRandom()%(range + 1); break;
+        case DIST_LOG:
+        {
+            // Log-uniform: pick a power of two scale in range, then a size inside that scale
+            unsigned int maxShift = 0;
+            while ((maxShift < 31) && (((unsigned long long)config.sizeMin << (maxShift + 1)) <= config.sizeMax)) maxShift++;
+
+            unsigned int shift = GetRandom()%(maxShift + 1);
+            unsigned long long scaleMin = (unsigned long long)config.sizeMin << shift;
+            unsigned long long scaleMax = ((scaleMin*2) < config.sizeMax)? scaleMin*2 : config.sizeMax;
+
+            size = (unsigned int)(scaleMin + GetRandom()%(scaleMax - scaleMin + 1));
+        } break;
+        default: break;
+    }
+
+    return size;
+}
+
+// Get chunk source fileName (synthetic)
+// NOTE: All fileNames have the same length, rresGetResourceId() compares fileNames prefix
+static void GetChunkFileName(unsigned int index, char *fileName)
+{
+    snprintf(fileName, 64, "resources/data_%05u.dat", index);
+}
+
+// Generate synthetic rres file, returns chunks ids
+// NOTE: Chunks are generated as uncompressed/unencrypted RRES_DATA_RAW, props: size, ext01, ext02, reserved
+static unsigned int *GenerateFile(BenchConfig config)
+{
+    FILE *rresFile = fopen(config.fileName, "wb");
+    if (rresFile == NULL) return NULL;
+
+    unsigned int *ids = (unsigned int *)calloc(config.chunkCount, sizeof(unsigned int));
+    unsigned int *offsets = (unsigned int *)calloc(config.chunkCount, sizeof(unsigned int));
+    unsigned char *buffer = (unsigned char *)malloc(5*sizeof(unsigned int) + config.sizeMax);
+    char fileName[64] = { 0 };
+
+    rresFileHeader header = {
+        .id[0] = 'r',           // File identifier: rres
+        .id[1] = 'r',           // File identifier: rres
+        .id[2] = 'e',           // File identifier: rres
+        .id[3] = 's',           // File identifier: rres
+        .version = 100,         // File version: 100 for version 1.0
+        .chunkCount = (unsigned short)(config.chunkCount + (config.cdir? 1 : 0)),
+        .cdOffset = 0,          // Central Directory offset, updated once resource chunks are written
+        .reserved = 0           // <reserved>
+    };
+
+    fwrite(&header, sizeof(rresFileHeader), 1, rresFile);
+
+    for (unsigned int i = 0; i < config.chunkCount; i++)
+    {
+        GetChunkFileName(i, fileName);
+
+        unsigned int rawSize = GetChunkSize(config);
+        unsigned int *props = (unsigned int *)buffer;
+        props[0] = 4;                   // propCount
+        props[1] = rawSize;             // Data size
+        props[2] = 0x7461642e;          // File extension: ".dat"
+        props[3] = 0;
+        props[4] = 0;
+        for (unsigned int k = 0; k < rawSize; k++) buffer[5*sizeof(unsigned int) + k] = (unsigned char)GetRandom();
+
+        rresResourceChunkInfo info = { 0 };
+        info.type[0] = 'R'; info.type[1] = 'A'; info.type[2] = 'W'; info.type[3] = 'D';
+        info.id = rresComputeCRC32((const unsigned char *)fileName, (int)strlen(fileName));
+        info.baseSize = 5*sizeof(unsigned int) + rawSize;
+        info.packedSize = info.baseSize;
+        info.crc32 = rresComputeCRC32(buffer, info.packedSize);
+
+        ids[i] = info.id;
+        offsets[i] = (unsigned int)ftell(rresFile);
+
+        fwrite(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
+        fwrite(buffer, info.packedSize, 1, rresFile);
+    }
+
+    if (config.cdir)
+    {
+        // Central Directory: propCount + props[0]: entries count + entries[]
+        // NOTE: Every entry: id + offset + reserved + fileNameSize + fileName (NULL terminated, 4-byte padded)
+        unsigned int cdirSize = 2*sizeof(unsigned int);
+        for (unsigned int i = 0; i < config.chunkCount; i++)
+        {
+            GetChunkFileName(i, fileName);
+            cdirSize += 4*sizeof(unsigned int) + (((unsigned int)strlen(fileName) + 1 + 3)/4)*4;
+        }
+
+        unsigned char *cdir = (unsigned char *)calloc(cdirSize, 1);
+        unsigned int *ptr = (unsigned int *)cdir;
+        ptr[0] = 1;                     // propCount
+        ptr[1] = config.chunkCount;     // Entries count
+        ptr += 2;
+
+        for (unsigned int i = 0; i < config.chunkCount; i++)
+        {
+            GetChunkFileName(i, fileName);
+            unsigned int fileNameSize = (((unsigned int)strlen(fileName) + 1 + 3)/4)*4;
+
+            ptr[0] = ids[i];
+            ptr[1] = offsets[i];
+            ptr[2] = 0;
+            ptr[3] = fileNameSize;
+            memcpy(ptr + 4, fileName, strlen(fileName));
+            ptr += (4 + fileNameSize/4);
+        }
+
+        rresResourceChunkInfo info = { 0 };
+        info.type[0] = 'C'; info.type[1] = 'D'; info.type[2] = 'I'; info.type[3] = 'R';
+        info.id = 0;
+        info.baseSize = cdirSize;
+        info.packedSize = cdirSize;
+        info.crc32 = rresComputeCRC32(cdir, cdirSize);
+
+        // NOTE: Central directory offset is relative to the end of file header
+        header.cdOffset = (unsigned int)ftell(rresFile) - sizeof(rresFileHeader);
+
+        fwrite(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
+        fwrite(cdir, cdirSize, 1, rresFile);
+        free(cdir);
+
+        fseek(rresFile, 0, SEEK_SET);
+        fwrite(&header, sizeof(rresFileHeader), 1, rresFile);
+    }
+
+    fclose(rresFile);
+    free(buffer);
+    free(offsets);
+
+    return ids;
+}
@@ -0,0 +1,488 @@
+/*******************************************************************************************
+*
+*   rres benchmark - startup trace replay (cold/warm page cache)
+*
+*   This benchmark replays a recorded list of resource loads against a rres file, the same
+*   sequence is run with a cold page cache (file pages dropped before every run) and a warm one:
+*     - Total replay time
+*     - Per-load latency percentiles: p50, p99, max
+*     - I/O bytes: requested by rres.h (RRES_SUPPORT_STATS) and read from disk (Linux only)
+*
+*   Loads are issued through rresLoadResourceChunk(), or rresLoadResourceMulti() for resources
+*   split in multiple chunks, so it measures the same path used by a real level load
+*
+*   Trace file format (text), one load per line, '#' starts a comment:
+*       <time_ms> <id|fileName> [multi]
+*
+*       0.0     0x3c7a2b11              # Resource id (hex or decimal)
+*       1.5     resources/level1.png    # Resource fileName, resolved with central directory
+*       2.0     0x1f00aa32 multi        # Force rresLoadResourceMulti()
+*
+*   NOTE: If no trace is provided, all resources in the file are loaded once, in file order
+*   NOTE: Loads are issued back-to-back by default, use --realtime to honor trace times
+*
+*   USAGE:
+*       rres_bench_replay --file <file.rres> [options]
+*           --trace <file.txt>      Trace file to replay (default: all resources in file order)
+*           --iterations <count>    Replay runs per cache mode (default: 5)
+*           --realtime              Wait until every load time before issuing it
+*           --output <file.json>    Results output file (default: stdout)
+*
+*   NOTE: Cold runs require posix_fadvise(POSIX_FADV_DONTNEED), not available on Windows,
+*   in that case cold results are reported as not supported
+*
+*   This benchmark has been created using rres 1.0 (github.com/raysan5/rres)
+*   It does not require raylib, only rres.h is used
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2022-2024 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200112L     // Required for: posix_fadvise(), fdatasync(), nanosleep()
+#endif
+
+#include <stdio.h>                      // Required for: printf(), fprintf(), fopen(), fgets()
+#include <stdlib.h>                     // Required for: malloc(), free(), qsort(), strtoul(), strtod()
+#include <string.h>                     // Required for: strcmp(), strtok(), strchr()
+
+#if !defined(_WIN32)
+    #include <fcntl.h>                  // Required for: open(), posix_fadvise()
+    #include <unistd.h>                 // Required for: close(), fdatasync()
+    #include <time.h>                   // Required for: nanosleep()
+#endif
+
+#define RRES_SUPPORT_STATS              // Required to measure I/O requested by rres.h
+#define RRES_LOG(...)           ((void)0)   // Avoid log messages, they would be measured
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to read rres data chunks
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define BENCH_TRACE_LINE_SIZE    1024   // Trace file max line size
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Trace load entry
+typedef struct {
+    unsigned long long time;            // Load time since trace start (nanoseconds)
+    unsigned int id;                    // Resource id to load
+    int multi;                          // Load with rresLoadResourceMulti()
+} TraceLoad;
+
+// Benchmark configuration
+typedef struct {
+    const char *fileName;               // rres file to load resources from
+    const char *traceFileName;          // Trace file to replay
+    unsigned int iterations;            // Replay runs per cache mode
+    int realtime;                       // Honor trace load times
+    const char *outputFileName;         // Results output file
+} BenchConfig;
+
+// Replay results for one cache mode
+typedef struct {
+    unsigned int runs;                  // Replay runs
+    unsigned long long totalMin;        // Replay min total time (nanoseconds)
+    unsigned long long totalMax;        // Replay max total time (nanoseconds)
+    unsigned long long totalSum;        // Replay total time sum, all runs (nanoseconds)
+    unsigned long long *latencies;      // Load latencies, all runs (nanoseconds)
+    unsigned int latencyCount;          // Load latencies count
+    unsigned long long readBytes;       // Bytes requested by rres.h, all runs
+    unsigned long long readCount;       // File read calls, all runs
+    unsigned long long seekCount;       // File seek calls, all runs
+    long long diskReadBytes;            // Bytes read from storage device, all runs (-1 if not available)
+    unsigned int errors;                // Loads failed, all runs
+} ReplayResult;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static TraceLoad *LoadTrace(const char *traceFileName, const char *fileName, unsigned int *count); // Load trace file, ids resolved
+static TraceLoad *GenerateTrace(const char *fileName, unsigned int *count); // Generate trace: all resources in file order
+static int DropFileCache(const char *fileName);                     // Drop file pages from OS page cache
+static long long GetDiskReadBytes(void);                            // Get process bytes read from storage (-1 if not available)
+static void WaitUntil(unsigned long long time);                     // Wait until provided rresGetTimeNs() time
+static void ReplayTrace(BenchConfig config, const TraceLoad *loads, unsigned int count, int cold, ReplayResult *result); // Replay trace once
+static void WriteResult(FILE *output, const char *name, ReplayResult result, int supported, unsigned int count); // Write replay results as JSON object
+static int CompareLatency(const void *a, const void *b);            // Compare latencies, required by qsort()
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    BenchConfig config = {
+        .fileName = NULL,
+        .traceFileName = NULL,
+        .iterations = 5,
+        .realtime = 0,
+        .outputFileName = NULL
+    };
+
+    // Parse command-line options
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--file") == 0) && (i + 1 < argc)) config.fileName = argv[++i];
+        else if ((strcmp(argv[i], "--trace") == 0) && (i + 1 < argc)) config.traceFileName = argv[++i];
+        else if ((strcmp(argv[i], "--iterations") == 0) && (i + 1 < argc)) config.iterations = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--realtime") == 0) config.realtime = 1;
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc)) config.outputFileName = argv[++i];
+        else { fprintf(stderr, "BENCH: Unknown option: %s\n", argv[i]); return 1; }
+    }
+
+    if (config.fileName == NULL) { fprintf(stderr, "BENCH: rres file required: --file <file.rres>\n"); return 1; }
+    if (config.iterations < 1) config.iterations = 1;
+
+    FILE *rresFile = fopen(config.fileName, "rb");
+    if (rresFile == NULL) { fprintf(stderr, "BENCH: rres file could not be opened: %s\n", config.fileName); return 1; }
+    fseek(rresFile, 0, SEEK_END);
+    long fileSize = ftell(rresFile);
+    fclose(rresFile);
+
+    unsigned int count = 0;
+    TraceLoad *loads = NULL;
+    if (config.traceFileName != NULL) loads = LoadTrace(config.traceFileName, config.fileName, &count);
+    else loads = GenerateTrace(config.fileName, &count);
+
+    if ((loads == NULL) || (count == 0)) { fprintf(stderr, "BENCH: No loads available to replay\n"); free(loads); return 1; }
+
+    FILE *output = stdout;
+    if (config.outputFileName != NULL) output = fopen(config.outputFileName, "wt");
+    if (output == NULL) { fprintf(stderr, "BENCH: Output file could not be opened\n"); free(loads); return 1; }
+
+    ReplayResult cold = { 0 };
+    ReplayResult warm = { 0 };
+    cold.latencies = (unsigned long long *)calloc((size_t)count*config.iterations, sizeof(unsigned long long));
+    warm.latencies = (unsigned long long *)calloc((size_t)count*config.iterations, sizeof(unsigned long long));
+
+    // Cold page cache: file pages dropped before every run
+    // NOTE: If file pages can not be dropped, cold runs are skipped
+    int coldSupported = DropFileCache(config.fileName);
+    if (coldSupported)
+    {
+        for (unsigned int i = 0; i < config.iterations; i++) ReplayTrace(config, loads, count, 1, &cold);
+    }
+    else fprintf(stderr, "BENCH: WARNING: File pages can not be dropped from page cache, cold runs skipped\n");
+
+    // Warm page cache: one replay not measured to load file pages
+    ReplayResult warmup = { 0 };
+    warmup.latencies = (unsigned long long *)calloc(count, sizeof(unsigned long long));
+    ReplayTrace(config, loads, count, 0, &warmup);
+    free(warmup.latencies);
+
+    for (unsigned int i = 0; i < config.iterations; i++) ReplayTrace(config, loads, count, 0, &warm);
+
+    fprintf(output, "{\n  \"benchmark\": \"rres_bench_replay\",\n");
+    fprintf(output, "  \"config\": { \"file\": \"%s\", \"trace\": %s%s%s, \"loads\": %u, \"iterations\": %u, \"realtime\": %s, \"fileSize\": %li },\n",
+        config.fileName, (config.traceFileName != NULL)? "\"" : "", (config.traceFileName != NULL)? config.traceFileName : "null",
+        (config.traceFileName != NULL)? "\"" : "", count, config.iterations, config.realtime? "true" : "false", fileSize);
+
+    WriteResult(output, "cold", cold, coldSupported, count);
+    fprintf(output, ",\n");
+    WriteResult(output, "warm", warm, 1, count);
+    fprintf(output, "\n}\n");
+
+    if (output != stdout) fclose(output);
+
+    free(cold.latencies);
+    free(warm.latencies);
+    free(loads);
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load trace file, ids resolved
+// NOTE: Resources fileNames are resolved to ids using the file central directory
+static TraceLoad *LoadTrace(const char *traceFileName, const char *fileName, unsigned int *count)
+{
+    FILE *traceFile = fopen(traceFileName, "rt");
+    if (traceFile == NULL) { fprintf(stderr, "BENCH: Trace file could not be opened: %s\n", traceFileName); return NULL; }
+
+    rresCentralDir dir = { 0 };
+    int dirLoaded = 0;
+
+    unsigned int capacity = 256;
+    TraceLoad *loads = (TraceLoad *)calloc(capacity, sizeof(TraceLoad));
+    char line[BENCH_TRACE_LINE_SIZE] = { 0 };
+    unsigned int lineNumber = 0;
+
+    *count = 0;
+
+    while (fgets(line, BENCH_TRACE_LINE_SIZE, traceFile) != NULL)
+    {
+        lineNumber++;
+
+        char *comment = strchr(line, '#');
+        if (comment != NULL) *comment = '\0';
+
+        char *timeToken = strtok(line, " \t\r\n");
+        char *idToken = strtok(NULL, " \t\r\n");
+        char *modeToken = strtok(NULL, " \t\r\n");
+
+        if (timeToken == NULL) continue;    // Empty line
+        if (idToken == NULL) { fprintf(stderr, "BENCH: WARNING: Trace line %u not valid, skipped\n", lineNumber); continue; }
+
+        TraceLoad load = { 0 };
+        load.time = (unsigned long long)(strtod(timeToken, NULL)*1000000.0);
+        load.multi = ((modeToken != NULL) && (strcmp(modeToken, "multi") == 0));
+
+        char *end = NULL;
+        load.id = (unsigned int)strtoul(idToken, &end, 0);
+
+        if (*end != '\0')
+        {
+            // Not a number, resolve resource fileName to id
+            if (!dirLoaded)
+            {
+                dir = rresLoadCentralDirectory(fileName);
+                dirLoaded = 1;
+            }
+
+            load.id = rresGetResourceId(dir, idToken);
+        }
+
+        if (load.id == 0) { fprintf(stderr, "BENCH: WARNING: Trace line %u resource not found: %s\n", lineNumber, idToken); continue; }
+
+        if (*count == capacity)
+        {
+            capacity *= 2;
+            loads = (TraceLoad *)realloc(loads, capacity*sizeof(TraceLoad));
+        }
+
+        loads[*count] = load;
+        (*count)++;
+    }
+
+    if (dirLoaded) rresUnloadCentralDirectory(dir);
+    fclose(traceFile);
+
+    // Resources split in multiple chunks are loaded with rresLoadResourceMulti()
+    unsigned int infoCount = 0;
+    rresResourceChunkInfo *infos = rresLoadResourceChunkInfoAll(fileName, &infoCount);
+
+    for (unsigned int i = 0; i < *count; i++)
+    {
+        for (unsigned int k = 0; k < infoCount; k++)
+        {
+            if (infos[k].id == loads[i].id)
+            {
+                if (infos[k].nextOffset != 0) loads[i].multi = 1;
+                break;
+            }
+        }
+    }
+
+    RRES_FREE(infos);
+
+    return loads;
+}
+
+// Generate trace: all resources in file order
+// NOTE: Only first chunk of every resource is considered, central directory is skipped
+static TraceLoad *GenerateTrace(const char *fileName, unsigned int *count)
+{
+    unsigned int infoCount = 0;
+    rresResourceChunkInfo *infos = rresLoadResourceChunkInfoAll(fileName, &infoCount);
+
+    TraceLoad *loads = (TraceLoad *)calloc((infoCount > 0)? infoCount : 1, sizeof(TraceLoad));
+    *count = 0;
+
+    for (unsigned int i = 0; i < infoCount; i++)
+    {
+        if ((infos[i].id == 0) || (memcmp(infos[i].type, "CDIR", 4) == 0)) continue;
+
+        // Skip chunks of a resource already added (multiple chunks resources share id)
+        int found = 0;
+        for (unsigned int k = 0; k < *count; k++) if (loads[k].id == infos[i].id) { found = 1; break; }
+        if (found) continue;
+
+        loads[*count].time = 0;
+        loads[*count].id = infos[i].id;
+        loads[*count].multi = (infos[i].nextOffset != 0);
+        (*count)++;
+    }
+
+    RRES_FREE(infos);
+
+    return loads;
+}
+
+// Drop file pages from OS page cache
+// NOTE: Dirty pages are not dropped, file data is synchronized first
+static int DropFileCache(const char *fileName)
+{
+    int result = 0;
+
+#if !defined(_WIN32)
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd >= 0)
+    {
+        fdatasync(fd);
+        result = (posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0);
+        close(fd);
+    }
+#else
+    (void)fileName;
+#endif
+
+    return result;
+}
+
+// Get process bytes read from storage (-1 if not available)
+// NOTE: Only available on Linux (/proc/self/io), page cache hits are not counted
+static long long GetDiskReadBytes(void)
+{
+    long long bytes = -1;
+
+#if defined(__linux__)
+    FILE *ioFile = fopen("/proc/self/io", "rt");
+
+    if (ioFile != NULL)
+    {
+        char line[128] = { 0 };
+
+        while (fgets(line, 128, ioFile) != NULL)
+        {
+            if (strncmp(line, "read_bytes:", 11) == 0) { bytes = strtoll(line + 11, NULL, 10); break; }
+        }
+
+        fclose(ioFile);
+    }
+#endif
+
+    return bytes;
+}
+
+// Wait until provided rresGetTimeNs() time
+static void WaitUntil(unsigned long long time)
+{
+    unsigned long long now = rresGetTimeNs();
+    if (now >= time) return;
+
+#if !defined(_WIN32)
+    struct timespec wait = { 0 };
+    wait.tv_sec = (time_t)((time - now)/1000000000ULL);
+    wait.tv_nsec = (long)((time - now)%1000000000ULL);
+    nanosleep(&wait, NULL);
+#else
+    while (rresGetTimeNs() < time) { }  // Busy wait, Sleep() resolution is not enough
+#endif
+}
+
+// Replay trace once
+static void ReplayTrace(BenchConfig config, const TraceLoad *loads, unsigned int count, int cold, ReplayResult *result)
+{
+    if (cold) DropFileCache(config.fileName);
+
+    rresResetStats();
+    long long diskStart = GetDiskReadBytes();
+    unsigned long long start = rresGetTimeNs();
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (config.realtime) WaitUntil(start + loads[i].time);
+
+        unsigned long long time = rresGetTimeNs();
+
+        if (loads[i].multi)
+        {
+            rresResourceMulti multi = rresLoadResourceMulti(config.fileName, loads[i].id);
+            result->latencies[result->latencyCount++] = rresGetTimeNs() - time;
+
+            if (multi.count == 0) result->errors++;
+            rresUnloadResourceMulti(multi);
+        }
+        else
+        {
+            rresResourceChunk chunk = rresLoadResourceChunk(config.fileName, loads[i].id);
+            result->latencies[result->latencyCount++] = rresGetTimeNs() - time;
+
+            if (chunk.data.raw == NULL) result->errors++;
+            rresUnloadResourceChunk(chunk);
+        }
+    }
+
+    unsigned long long total = rresGetTimeNs() - start;
+    long long diskEnd = GetDiskReadBytes();
+    rresStats stats = rresGetStats();
+
+    if ((result->runs == 0) || (total < result->totalMin)) result->totalMin = total;
+    if (total > result->totalMax) result->totalMax = total;
+    result->totalSum += total;
+    result->readBytes += stats.readBytes;
+    result->readCount += stats.readCount;
+    result->seekCount += stats.seekCount;
+
+    if ((diskStart < 0) || (diskEnd < 0)) result->diskReadBytes = -1;
+    else if ((result->runs == 0) || (result->diskReadBytes >= 0)) result->diskReadBytes += (diskEnd - diskStart);
+
+    result->runs++;
+}
+
+// Write replay results as JSON object
+// NOTE: Per run values are averaged over all runs
+static void WriteResult(FILE *output, const char *name, ReplayResult result, int supported, unsigned int count)
+{
+    if (!supported || (result.runs == 0))
+    {
+        fprintf(output, "  \"%s\": { \"supported\": false }", name);
+        return;
+    }
+
+    qsort(result.latencies, result.latencyCount, sizeof(unsigned long long), CompareLatency);
+
+    unsigned long long latencySum = 0;
+    for (unsigned int i = 0; i < result.latencyCount; i++) latencySum += result.latencies[i];
+
+    // NOTE: Nearest-rank percentiles
+    unsigned int p50 = (unsigned int)(((unsigned long long)result.latencyCount*50 + 99)/100);
+    unsigned int p99 = (unsigned int)(((unsigned long long)result.latencyCount*99 + 99)/100);
+
+    fprintf(output, "  \"%s\": {\n    \"supported\": true, \"runs\": %u, \"errors\": %u,\n", name, result.runs, result.errors);
+    fprintf(output, "    \"total\": { \"meanNs\": %.1f, \"minNs\": %llu, \"maxNs\": %llu },\n",
+        (double)result.totalSum/result.runs, result.totalMin, result.totalMax);
+    fprintf(output, "    \"load\": { \"samples\": %u, \"meanNs\": %.1f, \"p50Ns\": %llu, \"p99Ns\": %llu, \"maxNs\": %llu },\n",
+        result.latencyCount, (double)latencySum/result.latencyCount, result.latencies[p50 - 1], result.latencies[p99 - 1], result.latencies[result.latencyCount - 1]);
+    fprintf(output, "    \"io\": { \"readBytes\": %llu, \"readCount\": %llu, \"seekCount\": %llu, \"bytesPerLoad\": %.1f, \"diskReadBytes\": ",
+        result.readBytes/result.runs, result.readCount/result.runs, result.seekCount/result.runs, (double)result.readBytes/result.runs/count);
+
+    if (result.diskReadBytes >= 0) fprintf(output, "%lli }\n  }", result.diskReadBytes/result.runs);
+    else fprintf(output, "null }\n  }");
+}
+
+// Compare latencies, required by qsort()
+static int CompareLatency(const void *a, const void *b)
+{
+    unsigned long long la = *(const unsigned long long *)a;
+    unsigned long long lb = *(const unsigned long long *)b;
+
+    return (la > lb) - (la < lb);
+}
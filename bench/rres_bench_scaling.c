@@ -0,0 +1,312 @@
+/*******************************************************************************************
+*
+*   rres benchmark - blocks decompression scaling by threads count
+*
+*   This benchmark measures UnpackResourceChunk() for a large chunk compressed in independent blocks
+*   (RRES_FLAG_COMP_BLOCKS), unpacked with an increasing number of threads: 1, 2, 4... up to the
+*   CPU cores available. Every block is decompressed by the threads pool directly into its slice
+*   of the final buffer, using the bundled lz4.c (or DEFLATE, provided by raylib)
+*
+*   Payload is generated data with a compression ratio similar to usual game assets,
+*   or a provided file. Same data compressed as one stream is also measured as single-thread reference.
+*   Reported (JSON): unpack throughput (MB/s) and speedup over one thread, for every threads count
+*
+*   USAGE:
+*       rres_bench_scaling [options]
+*           --file <file>           Payload file (default: generated data)
+*           --size <bytes>          Generated data size (default: 134217728)
+*           --comp <lz4|deflate>    Compression algorithm (default: lz4)
+*           --block-size <bytes>    Compression block size (default: 131072)
+*           --max-threads <count>   Maximum threads measured, 0 for CPU cores available (default: 0)
+*           --iterations <count>    Unpack iterations per threads count (default: 5)
+*           --output <file.json>    Results output file (default: stdout)
+*
+*   NOTE: It runs headless, no window or audio device is initialized, time is measured with rresGetTimeNs()
+*
+*   This benchmark has been created using rres 1.0 (github.com/raysan5/rres)
+*   This benchmark uses raylib 4.1-dev (www.raylib.com) to load resources data
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2022-2024 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>                      // Required for: printf(), fprintf(), fopen()
+#include <stdlib.h>                     // Required for: strtoul(), atoi()
+#include <string.h>                     // Required for: strcmp(), memcmp(), memcpy()
+
+#if !defined(_WIN32)
+    #include <unistd.h>                 // Required for: sysconf()
+#endif
+
+#define RRES_LOG(...)           ((void)0)   // Avoid log messages, they would be measured
+#define RRES_SUPPORT_STATS                  // Required to measure time with rresGetTimeNs()
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#define RRES_SUPPORT_COMPRESSION_LZ4
+#define RRES_SUPPORT_THREADS                // Required to unpack blocks in multiple threads
+#include "../src/rres-raylib.h"       // Required to pack/unpack rres data chunks
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAX_BENCH_THREADS          32   // Max number of threads to benchmark (THREADS_MAX)
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static rresResourceChunk LoadChunkFromData(const unsigned char *data, unsigned int size); // Load unpacked chunk from data (RAWD)
+static rresResourceChunk CopyChunk(rresResourceChunk chunk);        // Copy packed resource chunk, including data
+static void GenerateData(unsigned char *data, unsigned int size);   // Generate data with a compression ratio similar to game assets
+static int GetCoresCount(void);                                     // Get CPU cores available
+static double MeasureUnpack(rresResourceChunk packed, const unsigned char *data, unsigned int size, unsigned int iterations, double *minTime, int *errors); // Measure unpack time (mean)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const char *fileName = NULL;
+    const char *outputFileName = NULL;
+    unsigned int dataSize = 128*1024*1024;
+    unsigned int blockSize = 128*1024;
+    unsigned int iterations = 5;
+    int compType = RRES_COMP_LZ4;
+    int maxThreads = 0;
+
+    // Parse command-line options
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--file") == 0) && (i + 1 < argc)) fileName = argv[++i];
+        else if ((strcmp(argv[i], "--size") == 0) && (i + 1 < argc)) dataSize = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--comp") == 0) && (i + 1 < argc)) compType = (strcmp(argv[++i], "deflate") == 0)? RRES_COMP_DEFLATE : RRES_COMP_LZ4;
+        else if ((strcmp(argv[i], "--block-size") == 0) && (i + 1 < argc)) blockSize = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--max-threads") == 0) && (i + 1 < argc)) maxThreads = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--iterations") == 0) && (i + 1 < argc)) iterations = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc)) outputFileName = argv[++i];
+        else { fprintf(stderr, "BENCH: Unknown option: %s\n", argv[i]); return 1; }
+    }
+
+    if (iterations < 1) iterations = 1;
+    if (dataSize < 1) dataSize = 1;
+    if (blockSize < 1) blockSize = 1;
+    if (maxThreads <= 0) maxThreads = GetCoresCount();
+    if (maxThreads > MAX_BENCH_THREADS) maxThreads = MAX_BENCH_THREADS;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    // Load payload
+    //----------------------------------------------------------------------------------
+    unsigned char *data = NULL;
+
+    if (fileName != NULL)
+    {
+        int fileSize = 0;
+        data = LoadFileData(fileName, &fileSize);
+        if (data == NULL) { fprintf(stderr, "BENCH: Payload file could not be loaded\n"); return 1; }
+        dataSize = (unsigned int)fileSize;
+    }
+    else
+    {
+        data = (unsigned char *)RL_MALLOC(dataSize);
+        GenerateData(data, dataSize);
+    }
+
+    rresResourceChunk chunk = LoadChunkFromData(data, dataSize);
+
+    // Pack payload: compressed in blocks and compressed as one stream (reference)
+    rresResourceChunk packedBlocks = CopyChunk(chunk);
+    SetCompressionBlockSize(blockSize);
+    int packResult = PackResourceChunk(&packedBlocks, compType, RRES_CIPHER_NONE);
+
+    rresResourceChunk packedStream = CopyChunk(chunk);
+    SetCompressionBlockSize(0);
+    if (packResult == 0) packResult = PackResourceChunk(&packedStream, compType, RRES_CIPHER_NONE);
+
+    if (packResult != 0) { fprintf(stderr, "BENCH: Payload could not be packed: %i\n", packResult); return 1; }
+    //----------------------------------------------------------------------------------
+
+    FILE *output = stdout;
+    if (outputFileName != NULL) output = fopen(outputFileName, "wt");
+    if (output == NULL) { fprintf(stderr, "BENCH: Output file could not be opened\n"); return 1; }
+
+    // Measure reference: one stream, single thread
+    double minStreamTime = 0.0;
+    int streamErrors = 0;
+    SetUnpackThreadCount(1);
+    double streamTime = MeasureUnpack(packedStream, data, dataSize, iterations, &minStreamTime, &streamErrors);
+
+    fprintf(output, "{\n  \"benchmark\": \"rres_bench_scaling\",\n  \"payload\": \"%s\",\n  \"comp\": \"%s\",\n  \"iterations\": %u,\n  \"cores\": %i,\n",
+        (fileName != NULL)? fileName : "generated", (compType == RRES_COMP_LZ4)? "LZ4" : "DEFLATE", iterations, GetCoresCount());
+    fprintf(output, "  \"baseSize\": %u,\n  \"blockSize\": %u,\n  \"packedSize\": %u,\n  \"streamPackedSize\": %u,\n",
+        packedBlocks.info.baseSize, blockSize, packedBlocks.info.packedSize, packedStream.info.packedSize);
+    fprintf(output, "  \"stream\": { \"threads\": 1, \"unpackMBs\": %.2f, \"unpackMaxMBs\": %.2f, \"errors\": %i },\n  \"results\": [\n",
+        dataSize/streamTime/1000000.0, dataSize/minStreamTime/1000000.0, streamErrors);
+
+    // Measure blocks: 1, 2, 4... maxThreads (maxThreads always measured)
+    double singleTime = 0.0;
+    bool first = true;
+
+    for (int threads = 1; threads <= maxThreads; threads = ((threads*2 > maxThreads) && (threads < maxThreads))? maxThreads : threads*2)
+    {
+        double minTime = 0.0;
+        int errors = 0;
+
+        SetUnpackThreadCount(threads);
+        double time = MeasureUnpack(packedBlocks, data, dataSize, iterations, &minTime, &errors);
+        if (threads == 1) singleTime = minTime;
+
+        fprintf(output, "%s    { \"threads\": %i, \"unpackMBs\": %.2f, \"unpackMaxMBs\": %.2f, \"speedup\": %.2f, \"errors\": %i }",
+            first? "" : ",\n", threads, dataSize/time/1000000.0, dataSize/minTime/1000000.0, singleTime/minTime, errors);
+
+        first = false;
+    }
+
+    fprintf(output, "\n  ]\n}\n");
+
+    if (output != stdout) fclose(output);
+
+    rresUnloadResourceChunk(packedStream);
+    rresUnloadResourceChunk(packedBlocks);
+    rresUnloadResourceChunk(chunk);
+    RL_FREE(data);
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load unpacked resource chunk from data (RAWD)
+static rresResourceChunk LoadChunkFromData(const unsigned char *data, unsigned int size)
+{
+    rresResourceChunk chunk = { 0 };
+
+    memcpy(chunk.info.type, "RAWD", 4);
+    chunk.info.id = 0x00000001;
+    chunk.info.baseSize = sizeof(int) + 4*sizeof(int) + size;
+    chunk.info.packedSize = chunk.info.baseSize;
+
+    chunk.data.propCount = 4;
+    chunk.data.props = (unsigned int *)RRES_CALLOC(4, sizeof(int));
+    chunk.data.props[0] = size;
+    chunk.data.props[1] = 0x2e62696e;   // Extension: ".bin"
+    chunk.data.raw = RRES_MALLOC(size);
+    memcpy(chunk.data.raw, data, size);
+
+    return chunk;
+}
+
+// Copy resource chunk, including data
+// NOTE: Unpacked chunks keep props separated, packed chunks only contain data
+static rresResourceChunk CopyChunk(rresResourceChunk chunk)
+{
+    rresResourceChunk copy = chunk;
+    unsigned int rawSize = (chunk.data.props == NULL)? chunk.info.packedSize : (chunk.info.baseSize - sizeof(int) - chunk.data.propCount*sizeof(int));
+
+    if (chunk.data.propCount > 0)
+    {
+        copy.data.props = (unsigned int *)RRES_CALLOC(chunk.data.propCount, sizeof(int));
+        memcpy(copy.data.props, chunk.data.props, chunk.data.propCount*sizeof(int));
+    }
+
+    copy.data.raw = RRES_MALLOC(rawSize);
+    memcpy(copy.data.raw, chunk.data.raw, rawSize);
+
+    return copy;
+}
+
+// Generate data with a compression ratio similar to game assets
+// NOTE: Sequences of repeated previous data (matches) mixed with random literals
+static void GenerateData(unsigned char *data, unsigned int size)
+{
+    unsigned int seed = 0x12345678;
+    unsigned int i = 0;
+
+    while (i < size)
+    {
+        seed = seed*1664525 + 1013904223;   // LCG, fast enough for large data
+
+        unsigned int length = 4 + ((seed >> 8) & 31);
+        if ((length + i) > size) length = size - i;
+
+        if (((seed >> 16) & 1) && (i > 1024))
+        {
+            // Match: copy previous data
+            unsigned int distance = 1 + ((seed >> 20) & 1023);
+            for (unsigned int j = 0; j < length; j++, i++) data[i] = data[i - distance];
+        }
+        else
+        {
+            // Literals: random data
+            for (unsigned int j = 0; j < length; j++, i++)
+            {
+                seed = seed*1664525 + 1013904223;
+                data[i] = (unsigned char)(seed >> 24);
+            }
+        }
+    }
+}
+
+// Get CPU cores available
+static int GetCoresCount(void)
+{
+    int cores = 8;
+
+#if defined(_SC_NPROCESSORS_ONLN)
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    if (count > 0) cores = (int)count;
+#endif
+
+    return cores;
+}
+
+// Measure unpack time, returns mean time (seconds)
+// NOTE: Unpacked data is validated against original data on every iteration
+static double MeasureUnpack(rresResourceChunk packed, const unsigned char *data, unsigned int size, unsigned int iterations, double *minTime, int *errors)
+{
+    double totalTime = 0.0;
+
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        rresResourceChunk chunk = CopyChunk(packed);
+
+        unsigned long long start = rresGetTimeNs();
+        int result = UnpackResourceChunk(&chunk);
+        double time = (double)(rresGetTimeNs() - start)/1000000000.0;
+
+        totalTime += time;
+        if ((i == 0) || (time < *minTime)) *minTime = time;
+
+        if ((result != 0) || (memcmp(chunk.data.raw, data, size) != 0)) (*errors)++;
+
+        rresUnloadResourceChunk(chunk);
+    }
+
+    return totalTime/iterations;
+}
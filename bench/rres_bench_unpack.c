@@ -0,0 +1,342 @@
+/*******************************************************************************************
+*
+*   rres benchmark - unpack throughput (decompression/decryption)
+*
+*   This benchmark measures UnpackResourceChunk() for every supported combination of compression
+*   (DEFLATE, LZ4, QOI) and encryption (AES, XChaCha20-Poly1305) over representative payloads:
+*     - IMGE: Example images (.png), loaded as RGBA pixels
+*     - WAVE: Example sounds (.wav), loaded as samples
+*     - RAWD: Example font file (.ttf) and generated random/zero data
+*
+*   Resource chunks are packed with PackResourceChunk() and every unpacked result is validated
+*   against the original data. Reported per combination (JSON): unpack throughput (MB/s),
+*   data throughput excluding key derivation (MB/s), compression ratio and peak memory allocated
+*
+*   USAGE:
+*       rres_bench_unpack [options]
+*           --resources <dir>       Resources directory (default: resources)
+*           --iterations <count>    Unpack iterations per combination (default: 10)
+*           --size <bytes>          Random/zero data size (default: 4194304)
+*           --key-cache <0|1>       Keep derived cipher keys cached between unpacks (default: 0)
+*           --threads <count>       Threads used to unpack large chunks, 0 for CPU cores available (default: 0)
+*           --output <file.json>    Results output file (default: stdout)
+*
+*   NOTE: It runs headless, no window or audio device is initialized, time is measured with rresGetTimeNs()
+*
+*   This benchmark has been created using rres 1.0 (github.com/raysan5/rres)
+*   This benchmark uses raylib 4.1-dev (www.raylib.com) to load resources data
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2022-2024 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>                      // Required for: printf(), fprintf(), fopen()
+#include <stdlib.h>                     // Required for: malloc(), free(), strtoul(), atoi()
+#include <string.h>                     // Required for: strcmp(), memcmp(), memcpy()
+
+#define RRES_LOG(...)           ((void)0)   // Avoid log messages, they would be measured
+#define RRES_SUPPORT_STATS                  // Required to measure memory allocations and stages timing
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#define RRES_SUPPORT_COMPRESSION_LZ4
+#define RRES_SUPPORT_ENCRYPTION_AES
+#define RRES_SUPPORT_ENCRYPTION_XCHACHA20
+#define RRES_SUPPORT_THREADS                // Required to measure large chunks unpacking scaling with threads
+#include "../src/rres-raylib.h"       // Required to pack/unpack rres data chunks
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAX_BENCH_PAYLOADS         10   // Max number of payloads to benchmark
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Benchmark payload, resource chunk unpacked
+typedef struct {
+    const char *name;                   // Payload name
+    rresResourceChunk chunk;            // Resource chunk, unpacked
+} BenchPayload;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static rresResourceChunk LoadChunkFromData(const char *type, const unsigned int *props, unsigned int propCount, const void *data, unsigned int size); // Load unpacked chunk from data
+static rresResourceChunk CopyChunk(rresResourceChunk chunk);        // Copy resource chunk, including data
+static bool CompareChunks(rresResourceChunk a, rresResourceChunk b); // Compare unpacked resource chunks data
+static unsigned int GetRawSize(rresResourceChunk chunk);            // Get unpacked chunk raw data size
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const char *resourcesDir = "resources";
+    const char *outputFileName = NULL;
+    unsigned int iterations = 10;
+    unsigned int dataSize = 4*1024*1024;
+    int keyCache = 0;
+    int threads = 0;
+
+    // Parse command-line options
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--resources") == 0) && (i + 1 < argc)) resourcesDir = argv[++i];
+        else if ((strcmp(argv[i], "--iterations") == 0) && (i + 1 < argc)) iterations = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--size") == 0) && (i + 1 < argc)) dataSize = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--key-cache") == 0) && (i + 1 < argc)) keyCache = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--threads") == 0) && (i + 1 < argc)) threads = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc)) outputFileName = argv[++i];
+        else { fprintf(stderr, "BENCH: Unknown option: %s\n", argv[i]); return 1; }
+    }
+
+    if (iterations < 1) iterations = 1;
+    if (dataSize < 1) dataSize = 1;
+
+    SetTraceLogLevel(LOG_WARNING);
+    rresSetCipherPassword("rres-bench-password");
+    SetUnpackThreadCount(threads);
+
+    // Load payloads
+    // NOTE: No window or audio device required, only data loading functions are used
+    //----------------------------------------------------------------------------------
+    BenchPayload payloads[MAX_BENCH_PAYLOADS] = { 0 };
+    int payloadCount = 0;
+    char path[512] = { 0 };
+
+    const char *imageFiles[] = { "images/cat.png", "images/fudesumi.png", "images/parrots.png" };
+    for (int i = 0; i < 3; i++)
+    {
+        snprintf(path, 512, "%s/%s", resourcesDir, imageFiles[i]);
+        Image image = LoadImage(path);
+        if (image.data == NULL) continue;
+
+        ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        unsigned int props[4] = { image.width, image.height, RRES_PIXELFORMAT_UNCOMP_R8G8B8A8, 1 };
+        payloads[payloadCount].name = imageFiles[i];
+        payloads[payloadCount].chunk = LoadChunkFromData("IMGE", props, 4, image.data, GetPixelDataSize(image.width, image.height, image.format));
+        payloadCount++;
+
+        UnloadImage(image);
+    }
+
+    const char *waveFiles[] = { "audio/sound.wav", "audio/coin.wav" };
+    for (int i = 0; i < 2; i++)
+    {
+        snprintf(path, 512, "%s/%s", resourcesDir, waveFiles[i]);
+        Wave wave = LoadWave(path);
+        if (wave.data == NULL) continue;
+
+        unsigned int props[4] = { wave.frameCount, wave.sampleRate, wave.sampleSize, wave.channels };
+        payloads[payloadCount].name = waveFiles[i];
+        payloads[payloadCount].chunk = LoadChunkFromData("WAVE", props, 4, wave.data, wave.frameCount*wave.channels*wave.sampleSize/8);
+        payloadCount++;
+
+        UnloadWave(wave);
+    }
+
+    snprintf(path, 512, "%s/%s", resourcesDir, "fonts/pixantiqua.ttf");
+    int fontDataSize = 0;
+    unsigned char *fontData = LoadFileData(path, &fontDataSize);
+    if (fontData != NULL)
+    {
+        unsigned int props[4] = { (unsigned int)fontDataSize, 0x2e747466, 0, 0 };   // Extension: ".ttf"
+        payloads[payloadCount].name = "fonts/pixantiqua.ttf";
+        payloads[payloadCount].chunk = LoadChunkFromData("RAWD", props, 4, fontData, fontDataSize);
+        payloadCount++;
+
+        UnloadFileData(fontData);
+    }
+
+    unsigned char *data = (unsigned char *)RL_CALLOC(dataSize, 1);
+    unsigned int props[4] = { dataSize, 0x2e62696e, 0, 0 };                         // Extension: ".bin"
+
+    payloads[payloadCount].name = "zero";
+    payloads[payloadCount].chunk = LoadChunkFromData("RAWD", props, 4, data, dataSize);
+    payloadCount++;
+
+    for (unsigned int i = 0; i < dataSize; i++) data[i] = (unsigned char)GetRandomValue(0, 255);
+    payloads[payloadCount].name = "random";
+    payloads[payloadCount].chunk = LoadChunkFromData("RAWD", props, 4, data, dataSize);
+    payloadCount++;
+
+    RL_FREE(data);
+    //----------------------------------------------------------------------------------
+
+    FILE *output = stdout;
+    if (outputFileName != NULL) output = fopen(outputFileName, "wt");
+    if (output == NULL) { fprintf(stderr, "BENCH: Output file could not be opened\n"); return 1; }
+
+    const int compTypes[4] = { RRES_COMP_NONE, RRES_COMP_DEFLATE, RRES_COMP_LZ4, RRES_COMP_QOI };
+    const char *compNames[4] = { "NONE", "DEFLATE", "LZ4", "QOI" };
+    const int cipherTypes[4] = { RRES_CIPHER_NONE, RRES_CIPHER_AES, RRES_CIPHER_XCHACHA20_POLY1305, RRES_CIPHER_XCHACHA20_POLY1305_SEGMENTED };
+    const char *cipherNames[4] = { "NONE", "AES", "XCHACHA20_POLY1305", "XCHACHA20_POLY1305_SEGMENTED" };
+
+    fprintf(output, "{\n  \"benchmark\": \"rres_bench_unpack\",\n  \"iterations\": %u,\n  \"keyCache\": %s,\n  \"threads\": %i,\n  \"results\": [\n", iterations, keyCache? "true" : "false", threads);
+
+    bool first = true;
+
+    for (int p = 0; p < payloadCount; p++)
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            for (int e = 0; e < 4; e++)
+            {
+                // NOTE: Data not compressed/encrypted is not unpacked, nothing to measure
+                if ((compTypes[c] == RRES_COMP_NONE) && (cipherTypes[e] == RRES_CIPHER_NONE)) continue;
+
+                // Pack resource chunk, skipping combinations not supported by payload (QOI only supports images)
+                rresResourceChunk packed = CopyChunk(payloads[p].chunk);
+
+                unsigned long long packStart = rresGetTimeNs();
+                int packResult = PackResourceChunk(&packed, compTypes[c], cipherTypes[e]);
+                double packTime = (double)(rresGetTimeNs() - packStart)/1000000000.0;
+
+                if (packResult != 0)
+                {
+                    rresUnloadResourceChunk(packed);
+                    continue;
+                }
+
+                unsigned int baseSize = payloads[p].chunk.info.baseSize;
+                double unpackTime = 0.0;
+                double minUnpackTime = 0.0;
+                unsigned long long keyTime = 0;
+                unsigned long long peakBytes = 0;
+                int errors = 0;
+
+                for (unsigned int i = 0; i < iterations; i++)
+                {
+                    rresResourceChunk chunk = CopyChunk(packed);
+
+                    // NOTE: By default keys are derived on every unpack, like chunks packed with a different salt each
+                    if (!keyCache) ClearCipherKeyCache();
+
+                    // NOTE: Chunk packed data is allocated by this benchmark, register it to measure memory properly
+                    rresResetStats();
+                    rresRecordStats(RRES_STATS_EVENT_ALLOC, 0, packed.info.packedSize, 0);
+                    unsigned long long usedBytes = rresGetStats().usedBytes;
+
+                    unsigned long long start = rresGetTimeNs();
+                    int result = UnpackResourceChunk(&chunk);
+                    double time = (double)(rresGetTimeNs() - start)/1000000000.0;
+
+                    rresStats stats = rresGetStats();
+                    if ((stats.peakBytes - usedBytes) > peakBytes) peakBytes = stats.peakBytes - usedBytes;
+                    keyTime += stats.keyTime;
+
+                    unpackTime += time;
+                    if ((i == 0) || (time < minUnpackTime)) minUnpackTime = time;
+
+                    if ((result != 0) || !CompareChunks(payloads[p].chunk, chunk)) errors++;
+
+                    rresUnloadResourceChunk(chunk);
+                }
+
+                double meanTime = unpackTime/iterations;
+                double meanKeyTime = (double)keyTime/iterations/1000000000.0;
+                double dataTime = meanTime - meanKeyTime;
+
+                fprintf(output, "%s    { \"payload\": \"%s\", \"type\": \"%c%c%c%c\", \"baseSize\": %u, \"comp\": \"%s\", \"cipher\": \"%s\", \"packedSize\": %u, \"ratio\": %.4f, ",
+                    first? "" : ",\n", payloads[p].name, packed.info.type[0], packed.info.type[1], packed.info.type[2], packed.info.type[3], baseSize,
+                    compNames[c], cipherNames[e], packed.info.packedSize, (double)packed.info.packedSize/baseSize);
+                fprintf(output, "\"packMBs\": %.2f, \"unpackMBs\": %.2f, \"unpackMaxMBs\": %.2f, \"dataMBs\": %.2f, \"keyMs\": %.3f, \"peakBytes\": %llu, \"errors\": %i }",
+                    (packTime > 0.0)? baseSize/packTime/1000000.0 : 0.0, (meanTime > 0.0)? baseSize/meanTime/1000000.0 : 0.0,
+                    (minUnpackTime > 0.0)? baseSize/minUnpackTime/1000000.0 : 0.0, (dataTime > 0.0)? baseSize/dataTime/1000000.0 : 0.0,
+                    meanKeyTime*1000.0, peakBytes, errors);
+
+                first = false;
+
+                rresUnloadResourceChunk(packed);
+            }
+        }
+    }
+
+    fprintf(output, "\n  ]\n}\n");
+
+    if (output != stdout) fclose(output);
+    for (int p = 0; p < payloadCount; p++) rresUnloadResourceChunk(payloads[p].chunk);
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load unpacked resource chunk from data
+static rresResourceChunk LoadChunkFromData(const char *type, const unsigned int *props, unsigned int propCount, const void *data, unsigned int size)
+{
+    rresResourceChunk chunk = { 0 };
+
+    memcpy(chunk.info.type, type, 4);
+    chunk.info.id = rresComputeCRC32((const unsigned char *)data, size);
+    chunk.info.baseSize = sizeof(int) + propCount*sizeof(int) + size;
+    chunk.info.packedSize = chunk.info.baseSize;
+
+    chunk.data.propCount = propCount;
+    chunk.data.props = (unsigned int *)RRES_CALLOC(propCount, sizeof(int));
+    memcpy(chunk.data.props, props, propCount*sizeof(int));
+    chunk.data.raw = RRES_CALLOC(size, 1);
+    memcpy(chunk.data.raw, data, size);
+
+    return chunk;
+}
+
+// Copy resource chunk, including data
+static rresResourceChunk CopyChunk(rresResourceChunk chunk)
+{
+    rresResourceChunk copy = chunk;
+    unsigned int rawSize = (chunk.data.props == NULL)? chunk.info.packedSize : GetRawSize(chunk);
+
+    if (chunk.data.propCount > 0)
+    {
+        copy.data.props = (unsigned int *)RRES_CALLOC(chunk.data.propCount, sizeof(int));
+        memcpy(copy.data.props, chunk.data.props, chunk.data.propCount*sizeof(int));
+    }
+
+    copy.data.raw = RRES_CALLOC(rawSize, 1);
+    memcpy(copy.data.raw, chunk.data.raw, rawSize);
+
+    return copy;
+}
+
+// Compare unpacked resource chunks data
+static bool CompareChunks(rresResourceChunk a, rresResourceChunk b)
+{
+    if ((a.info.baseSize != b.info.baseSize) || (a.data.propCount != b.data.propCount)) return false;
+    if ((a.data.propCount > 0) && (memcmp(a.data.props, b.data.props, a.data.propCount*sizeof(int)) != 0)) return false;
+
+    return (memcmp(a.data.raw, b.data.raw, GetRawSize(a)) == 0);
+}
+
+// Get unpacked chunk raw data size
+static unsigned int GetRawSize(rresResourceChunk chunk)
+{
+    return chunk.info.baseSize - sizeof(int) - chunk.data.propCount*sizeof(int);
+}
@@ -92,20 +92,22 @@ int main(void)
 // Get compression name as a text string
 static const char *GetCompressionName(int compType)
 {
-    // Map compression type: NONE;DEFLATE;LZ4;QOI
+    // Map compression type: NONE;DEFLATE;LZ4;QOI;INDEX
     if (compType == RRES_COMP_NONE) return "none";
     else if (compType == RRES_COMP_DEFLATE) return "DEFLATE";
     else if (compType == RRES_COMP_LZ4) return "LZ4";
     else if (compType == RRES_COMP_QOI) return "QOI";
+    else if (compType == RRES_COMP_INDEX_DELTA) return "INDEX";
     else return "Undefined";
 }
 
 // Get cipher name as a text string
 static const char *GetCipherName(int cipherType)
 {
-    // Map cipher type: NONE;AES;XCHACHA20
+    // Map cipher type: NONE;AES;XCHACHA20;XCHACHA20 (segmented)
     if (cipherType == RRES_CIPHER_NONE) return "none";
     else if (cipherType == RRES_CIPHER_AES) return "AES-256";
     else if (cipherType == RRES_CIPHER_XCHACHA20_POLY1305) return "XChaCha20";
+    else if (cipherType == RRES_CIPHER_XCHACHA20_POLY1305_SEGMENTED) return "XChaCha20-Seg";
     else return "Undefined";
 }
\ No newline at end of file
@@ -19,11 +19,45 @@
 *       Support data encryption algorithm XChaCha20-Poly1305,
 *       provided by monocypher.h/monocypher.c library
 *
+*   #define RRES_SUPPORT_THREADS
+*       Use multiple threads to unpack large resource chunks (data decryption by segments, decompression by blocks),
+*       using pthreads (POSIX) or Win32 threads, threads count can be set with SetUnpackThreadCount()
+*       Worker threads are created on first use and kept waiting for jobs, they are reused by next unpacks
+*
+*   #define RRES_PARALLEL_SEGMENT_SIZE
+*       Data segment size (bytes) processed by every parallel job, must be a multiple of 64, default value: 1 MB
+*       Chunks with data smaller than two segments are always unpacked in the calling thread
+*
+*   #define RRES_AES_NO_HARDWARE
+*       Disable AES hardware instructions (AES-NI on x86/x64, Crypto Extensions on ARMv8),
+*       by default they are used if supported by the CPU (checked at runtime), tiny-AES is used otherwise
+*
+*   #define RRES_FILTER_NO_SIMD
+*       Disable SIMD instructions (SSE2/AVX2 on x86, NEON on ARM) used to undo data filters (byte shuffle, delta, XOR)
+*       and to expand quantized vertex data to float, by default they are used if supported (AVX2 support is checked at runtime)
+*
+*   #define RRES_DEFLATE_USE_RAYLIB
+*       Decompress DEFLATE data with raylib DecompressData(), by default the bundled inflate decoder is used,
+*       it decodes directly into the final buffer (table-driven, two literals per table entry, word-sized match copies)
+*
+*   #define RRES_RESOURCE_CACHE_BUDGET
+*       Default memory budget (in bytes) for the resource chunks cache, default value: 64 MB
+*       It can be changed at runtime with SetResourceCacheBudget()
+*
+*   #define RRES_CIPHER_KEY_CACHE_SIZE
+*       Number of cipher keys kept in memory, derived from (password, salt), default value: 16
+*       Key derivation (Argon2i, 16 MB, 3 passes) is only computed once per cached (password, salt)
+*
+*   #define RRES_CIPHER_SEGMENT_SIZE
+*       Data segment size (bytes) used on packing with RRES_CIPHER_XCHACHA20_POLY1305_SEGMENTED, default value: 64 KB
+*       Every segment is encrypted and authenticated independently, it's the minimum data read on random access
+*
 *   DEPENDENCIES:
 *
 *     - raylib.h: Data types definition and data loading from memory functions
 *                 WARNING: raylib.h MUST be included before including rres-raylib.h
 *     - rres.h:   Base implementation of rres specs, required to read rres files and resource chunks
+*                 NOTE: If included by rres-raylib.h, rres allocators are mapped to raylib allocators (RL_MALLOC...)
 *     - lz4.h:    LZ4 compression support (optional)
 *     - aes.h:    AES-256 CTR encryption support (optional)
 *     - monocypher.h: for XChaCha20-Poly1305 encryption support (optional)
@@ -62,18 +96,99 @@
 #define RRES_RAYLIB_H
 
 #ifndef RRES_H
+    // rres allocators mapped to raylib allocators (if not defined by user), so resource chunks data can be
+    // owned by raylib objects and released by raylib (i.e. UnloadImage()), required by Load*FromResourceConsume()
+    // WARNING: If rres.h is included before rres-raylib.h, RRES_* allocators must be compatible with RL_* allocators
+    #if defined(RL_MALLOC) && !defined(RRES_MALLOC)
+        #define RRES_MALLOC(sz)         RL_MALLOC(sz)
+    #endif
+    #if defined(RL_CALLOC) && !defined(RRES_CALLOC)
+        #define RRES_CALLOC(n,sz)       RL_CALLOC(n,sz)
+    #endif
+    #if defined(RL_REALLOC) && !defined(RRES_REALLOC)
+        #define RRES_REALLOC(ptr,sz)    RL_REALLOC(ptr,sz)
+    #endif
+    #if defined(RL_FREE) && !defined(RRES_FREE)
+        #define RRES_FREE(ptr)          RL_FREE(ptr)
+    #endif
+
     #include "rres.h"
 #endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-//...
+#ifndef RRES_RESOURCE_CACHE_BUDGET
+    #define RRES_RESOURCE_CACHE_BUDGET  (64*1024*1024)  // Resource cache default memory budget (bytes)
+#endif
+#ifndef RRES_PARALLEL_SEGMENT_SIZE
+    #define RRES_PARALLEL_SEGMENT_SIZE  (1024*1024)     // Data segment size processed by every parallel job (bytes)
+#endif
+#ifndef RRES_CIPHER_KEY_CACHE_SIZE
+    #define RRES_CIPHER_KEY_CACHE_SIZE            16    // Cipher keys cache size, derived from (password, salt)
+#endif
+#ifndef RRES_CIPHER_SEGMENT_SIZE
+    #define RRES_CIPHER_SEGMENT_SIZE      (64*1024)     // Segmented cipher data segment size (bytes), used on packing
+#endif
+
+#define RRES_VERTEX_ATTRIBUTES_MAX          16    // Maximum vertex attributes in interleaved vertex data
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Resource cache stats
+typedef struct ResourceCacheStats {
+    unsigned int hits;              // Requests served from cache
+    unsigned int misses;            // Requests that required loading + unpacking from file
+    unsigned int evictions;         // Chunks evicted from cache to fit memory budget
+    unsigned int count;             // Chunks currently cached
+    unsigned int usedBytes;         // Memory currently used by cached chunks (bytes)
+    unsigned int budgetBytes;       // Memory budget for cached chunks (bytes)
+} ResourceCacheStats;
+
+// Compression codec, registered for a compression algorithm (compType)
+// NOTE: Compressed data returned must be freed with RL_FREE(), decompressed data with RRES_FREE()
+typedef struct CompressionCodec {
+    const char *name;               // Codec name, used on logging
+    unsigned char *(*compress)(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned int *compSize); // Compress data (dictionary optional)
+    unsigned char *(*decompress)(const unsigned char *data, unsigned int size, unsigned int *dataSize); // Decompress data into new allocation (optional)
+    bool (*decompressInto)(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned char *output, unsigned int outputSize); // Decompress data into caller buffer, output size must match (optional)
+    bool blocks;                    // Codec supports data compressed in independent blocks: parallel and range decompression (RRES_FLAG_COMP_BLOCKS)
+    bool dictionary;                // Codec supports compression dictionaries (RRES_FLAG_COMP_DICTIONARY), requires decompressInto()
+} CompressionCodec;
+
+// Encryption cipher, registered for an encryption algorithm (cipherType)
+// NOTE: Encrypted data returned must be freed with RL_FREE(), data is decrypted in place
+typedef struct EncryptionCipher {
+    const char *name;               // Cipher name, used on logging
+    unsigned char *(*encrypt)(const unsigned char *data, unsigned int size, unsigned int *packedSize); // Encrypt data, cipher additional data appended
+    bool (*decrypt)(unsigned char *data, unsigned int size, unsigned int *dataSize); // Decrypt data in place, data not modified on failure
+    bool (*decryptRange)(const char *fileName, rresResourceChunkInfo info, unsigned int offset, unsigned int size, unsigned char *buffer); // Load decrypted data range from file (optional)
+} EncryptionCipher;
+
+// Compression policy, used to select compression algorithm per chunk on packing
+typedef enum CompressionPolicy {
+    COMPRESSION_POLICY_SIZE = 0,    // Smallest packed data
+    COMPRESSION_POLICY_SPEED,       // Fastest decompression (data size must be reduced)
+    COMPRESSION_POLICY_BUDGET,      // Smallest packed data with decompression speed over a minimum (MB/s)
+} CompressionPolicy;
+
+// Vertex attribute layout in interleaved vertex data
+typedef struct VertexAttributeDesc {
+    unsigned int attribute;         // Vertex attribute (rresVertexAttribute)
+    unsigned int componentCount;    // Vertex attribute components count
+    unsigned int format;            // Vertex attribute components format (rresVertexFormat)
+    unsigned int offset;            // Vertex attribute offset in vertex (bytes)
+} VertexAttributeDesc;
+
+// Vertex buffer, interleaved vertex data (all attributes of a vertex stored together)
+typedef struct VertexBuffer {
+    void *data;                     // Vertex data (vertexCount*stride bytes)
+    unsigned int vertexCount;       // Number of vertices
+    unsigned int stride;            // Vertex size (bytes)
+    unsigned int attributeCount;    // Vertex attributes count
+    VertexAttributeDesc attributes[RRES_VERTEX_ATTRIBUTES_MAX]; // Vertex attributes layout
+} VertexBuffer;
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -96,10 +211,121 @@ RLAPI Wave LoadWaveFromResource(rresResourceChunk chunk);       // Load Wave dat
 RLAPI Font LoadFontFromResource(rresResourceMulti multi);       // Load Font data from rres resource multiple chunks
 RLAPI Mesh LoadMeshFromResource(rresResourceMulti multi);       // Load Mesh data from rres resource multiple chunks
 
+// rres data loading to raylib data structures, consuming resource chunks
+// NOTE 1: Chunk data is unpacked (if required) and its ownership moved to returned object (no data copy),
+// chunk is always released by the function (also on failure), it must not be unloaded after the call
+// NOTE 2: Chunk data must be allocated with raylib compatible allocators (see rres.h inclusion)
+RLAPI void *LoadDataFromResourceConsume(rresResourceChunk chunk, unsigned int *size); // Load raw data from rres resource chunk, chunk consumed
+RLAPI char *LoadTextFromResourceConsume(rresResourceChunk chunk); // Load text data from rres resource chunk, chunk consumed
+RLAPI Image LoadImageFromResourceConsume(rresResourceChunk chunk); // Load Image data from rres resource chunk, chunk consumed
+RLAPI Wave LoadWaveFromResourceConsume(rresResourceChunk chunk); // Load Wave data from rres resource chunk, chunk consumed
+RLAPI Mesh LoadMeshFromResourceConsume(rresResourceMulti multi); // Load Mesh data from rres resource multiple chunks, chunks consumed
+
+// Interleaved vertex data (VRTX chunk, RRES_VERTEX_ATTRIBUTE_INTERLEAVED): all vertex attributes in one chunk,
+// attributes layout (stride, attributes format and offset) stored in chunk props, chunk raw data is the vertex buffer
+// NOTE 1: Vertex buffer data is ready to be uploaded to GPU in one call, consume variant takes chunk data (no copy)
+// NOTE 2: LoadMeshFromResource() also loads interleaved chunks, attributes are de-interleaved into Mesh arrays
+// NOTE 3: Generated chunks are unpacked, chunks id must be set by user, crc32 is computed by PackResourceChunk()
+RLAPI VertexBuffer LoadVertexBufferFromResource(rresResourceChunk chunk); // Load interleaved vertex buffer from rres resource chunk
+RLAPI VertexBuffer LoadVertexBufferFromResourceConsume(rresResourceChunk chunk); // Load interleaved vertex buffer from rres resource chunk, chunk consumed
+RLAPI void UnloadVertexBuffer(VertexBuffer buffer);              // Unload vertex buffer data
+RLAPI rresResourceMulti GenMeshResource(Mesh mesh);             // Generate mesh resource chunks: interleaved vertex data + indices (if available)
+
+// Quantized vertex data (VRTX chunk): float attributes stored as half-float, snorm16 or unorm16 values,
+// per component scale/offset stored in chunk props (value = normalized*scale + offset)
+// NOTE 1: LoadMeshFromResource() expands quantized attributes to float (SIMD: SSE2/AVX2 or NEON),
+// interleaved vertex buffers keep quantized attributes, to be normalized by GPU (no scale/offset)
+// NOTE 2: Chunk must be provided unpacked, float vertex data is replaced by quantized data, function returns 0 on success
+RLAPI int QuantizeResourceChunk(rresResourceChunk *chunk, int format); // Quantize vertex chunk data: RRES_VERTEX_FORMAT_HFLOAT, RRES_VERTEX_FORMAT_SHORT, RRES_VERTEX_FORMAT_USHORT
+
+// Vertex indices (VRTX chunk, RRES_VERTEX_ATTRIBUTE_INDEX): 16-bit (USHORT) or 32-bit (UINT) indices
+// NOTE 1: raylib Mesh only supports 16-bit indices, LoadMeshFromResource() converts 32-bit indices if all of them fit 16 bits,
+// LoadIndicesFromResource() loads indices as 32-bit values, i.e. to be uploaded to GPU with an interleaved vertex buffer
+// NOTE 2: Mesh chunks optimization reorders triangles for post-transform vertex cache locality (Tipsify) and vertices by
+// first use (vertex fetch locality), chunks must be unpacked, function returns 0 on success
+// NOTE 3: Index chunks can be compressed with RRES_COMP_INDEX_DELTA: every index stored as difference with previous index
+RLAPI unsigned int *LoadIndicesFromResource(rresResourceChunk chunk, unsigned int *count); // Load vertex indices from rres resource chunk (32-bit)
+RLAPI unsigned int *LoadIndicesFromResourceConsume(rresResourceChunk chunk, unsigned int *count); // Load vertex indices from rres resource chunk (32-bit), chunk consumed
+RLAPI int OptimizeMeshResource(rresResourceMulti *multi);       // Optimize mesh resource chunks: triangles reordered for vertex cache, vertices for vertex fetch
+
 // Unpack resource chunk data (decompres/decrypt data)
 // NOTE: Function return 0 on success or other value on failure
 RLAPI int UnpackResourceChunk(rresResourceChunk *chunk);        // Unpack resource chunk data (decompress/decrypt)
 
+// Pack resource chunk data (compress/encrypt data), inverse of UnpackResourceChunk()
+// NOTE 1: Chunk must be provided unpacked (propCount + props[] + raw), packed data is stored in chunk->data.raw
+// and chunk->info (compType, cipherType, packedSize, crc32) is updated, ready to be written to an rres file,
+// if no compression/encryption is requested, chunk data is kept unpacked (only chunk->info is updated)
+// NOTE 2: Function return 0 on success or other value on failure
+RLAPI int PackResourceChunk(rresResourceChunk *chunk, int compType, int cipherType); // Pack resource chunk data (compress/encrypt)
+
+// Set block size for data compression in independent blocks (DEFLATE, LZ4), used by PackResourceChunk()
+// NOTE 1: Blocks (64-256 KB recommended) can be decompressed independently, in parallel or only the ones
+// covering a requested data range, chunk is flagged with RRES_FLAG_COMP_BLOCKS, by default (size = 0) data is compressed as one stream
+// NOTE 2: QOI images are split in horizontal stripes of block size (complete rows), encoded/decoded in parallel
+RLAPI void SetCompressionBlockSize(unsigned int size);          // Set block size for data compression in independent blocks (0: one stream)
+
+// Data filters applied to raw data before compression (byte shuffle, delta, XOR), improve compression of float and 16-bit data
+// NOTE 1: Filter flags (RRES_FLAG_FILTER_*) set in chunk->info.flags before PackResourceChunk() are applied to compressed data,
+// UnpackResourceChunk() undoes them after decompression (SIMD: SSE2/AVX2 or NEON), flags are cleared for data not compressed
+// NOTE 2: Chunks with filters can not be loaded by range, LoadResourceDataRange() unpacks the full chunk
+RLAPI unsigned int GetCompressionFilter(const rresResourceChunk *chunk); // Get data filter flags recommended for chunk data (IMGE/WAVE/VRTX)
+
+// Compression dictionary shared by resource chunks in a file (FourCC: DICT), improves LZ4 compression of small chunks
+// NOTE 1: Dictionary is generated from unpacked chunks data, the dictionary set is used by PackResourceChunk() for LZ4 chunks
+// not compressed in blocks (chunk is flagged with RRES_FLAG_COMP_DICTIONARY), dictionary chunk must be written to the rres file
+// NOTE 2: Dictionaries are loaded once per file, LoadResourceChunkCached() and LoadResourceDataRange() load them automatically,
+// UnpackResourceChunk() requires the dictionaries previously loaded with LoadCompressionDictionaries()
+RLAPI rresResourceChunk GenCompressionDictionary(const rresResourceChunk *chunks, int count, unsigned int size); // Generate compression dictionary chunk, trained on unpacked chunks data (max size: 64 KB)
+RLAPI void SetCompressionDictionary(rresResourceChunk dictionary); // Set compression dictionary used by PackResourceChunk() (empty chunk: no dictionary)
+RLAPI int LoadCompressionDictionaries(const char *fileName);     // Load compression dictionaries from rres file, returns dictionaries loaded
+RLAPI void UnloadCompressionDictionaries(void);                 // Unload all compression dictionaries
+
+// Compression codecs and encryption ciphers registry, UnpackResourceChunk(), PackResourceChunk() and
+// LoadResourceDataRange() dispatch data processing to the codec/cipher registered for chunk compType/cipherType
+// NOTE: Built-in algorithms are registered by default (if supported), they can be replaced by user implementations,
+// an empty codec/cipher unregisters the algorithm
+RLAPI void SetCompressionCodec(int compType, CompressionCodec codec); // Set compression codec for compression algorithm
+RLAPI void SetEncryptionCipher(int cipherType, EncryptionCipher cipher); // Set encryption cipher for encryption algorithm
+
+// Compression algorithm selection per chunk: chunk data is compressed with every codec registered,
+// decompression is verified and timed, compression algorithm is selected by policy (CompressionPolicy)
+// NOTE 1: Selected compType is provided to PackResourceChunk(), compression block size and dictionary set are considered
+// NOTE 2: Selections are accumulated per chunk type (FourCC) and compression algorithm, LogCompressionReport() logs a summary
+RLAPI void SetCompressionPolicy(int policy, float minDecodeSpeed);  // Set compression policy, min decompression speed (MB/s) for COMPRESSION_POLICY_BUDGET
+RLAPI int SelectCompressionType(const rresResourceChunk *chunk);    // Select compression algorithm for unpacked chunk data, by compression policy
+RLAPI void LogCompressionReport(void);                          // Log compression selection summary per chunk type, summary is cleared
+
+// Load raw data range from resource chunk in file, range is relative to raw data (props not included)
+// NOTE 1: Only the data required for the range is read and unpacked for chunks not compressed or compressed in blocks
+// (RRES_FLAG_COMP_BLOCKS, only blocks covering the range are decompressed) and not encrypted or encrypted with
+// RRES_CIPHER_XCHACHA20_POLY1305_SEGMENTED (only segments covering the range are verified),
+// other packed chunks are fully loaded and unpacked to get the range
+// NOTE 2: Range is clamped to raw data size, returned data must be freed by user, NULL on failure
+RLAPI void *LoadResourceDataRange(const char *fileName, unsigned int rresId, unsigned int offset, unsigned int size, unsigned int *dataSize); // Load raw data range from resource chunk in file
+
+// Resource chunks cache: chunks are loaded + unpacked once and shared with a reference count
+// NOTE: Cached chunks are identified by (fileName, rresId), unreferenced chunks are kept in memory
+// until the cache memory budget is exceeded, then they are evicted in least-recently-used order
+// WARNING: Returned chunk is owned by the cache, it must be released with UnloadResourceChunkCached()
+RLAPI const rresResourceChunk *LoadResourceChunkCached(const char *fileName, unsigned int rresId); // Load resource chunk from cache (loaded + unpacked if not cached)
+RLAPI void UnloadResourceChunkCached(const rresResourceChunk *chunk); // Release cached resource chunk reference
+RLAPI void SetResourceCacheBudget(unsigned int budget);         // Set resource cache memory budget (bytes)
+RLAPI void ClearResourceCache(void);                            // Unload all unreferenced cached resource chunks
+RLAPI ResourceCacheStats GetResourceCacheStats(void);           // Get resource cache stats: hits, misses, evictions...
+
+// Cipher keys cache: keys derived from (password, salt) are kept in memory, key stretching is only
+// computed once for all chunks sharing the same salt, i.e. chunks packed with a shared salt (SetCipherSalt())
+// NOTE 1: Password is not stored, only its hash (BLAKE2b) is kept to identify cached keys
+// NOTE 2: Shared salt is only used by RRES_CIPHER_XCHACHA20_POLY1305, that stores a random nonce per chunk,
+// RRES_CIPHER_AES (CTR mode) stores no nonce, it requires a different key (salt) per chunk to be secure
+RLAPI void SetCipherSalt(const unsigned char *salt);            // Set salt[16] shared by all packed chunks (NULL for random salt per chunk)
+RLAPI void ClearCipherKeyCache(void);                           // Clear cipher keys cache, cached keys are wiped
+
+// Set threads used to unpack large resource chunks, only available if RRES_SUPPORT_THREADS is defined
+// NOTE: By default (count = 0), one thread per CPU core available is used
+RLAPI void SetUnpackThreadCount(int count);                     // Set threads used to unpack large chunks (0: CPU cores available)
+
 // Set base directory for externally linked data
 // NOTE: When resource chunk contains an external link (FourCC: LINK, Type: RRES_DATA_LINK),
 // a base directory is required to be prepended to link path
@@ -134,27 +360,408 @@ RLAPI void SetBaseDirectory(const char *baseDir);               // Set base dire
     // https://github.com/kokke/tiny-AES-c
     #include "external/aes.h"               // Encryption algorithm: AES
     #include "external/aes.c"               // Encryption algorithm implementation: AES
+
+    // AES hardware instructions: AES-NI (x86/x64) and Crypto Extensions (ARMv8 AArch64)
+    // NOTE: CPU support is checked at runtime, tiny-AES implementation is used as fallback
+    #if !defined(RRES_AES_NO_HARDWARE)
+        #if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+            #define RRES_AES_HARDWARE_X86
+            #include <wmmintrin.h>          // Required for: AES-NI intrinsics
+            #if defined(_MSC_VER)
+                #include <intrin.h>         // Required for: __cpuid()
+            #else
+                #include <cpuid.h>          // Required for: __get_cpuid()
+            #endif
+        #elif defined(__aarch64__) && (defined(__linux__) || defined(__APPLE__))
+            #define RRES_AES_HARDWARE_ARM
+            #include <arm_neon.h>           // Required for: ARMv8 Crypto Extensions intrinsics
+            #if defined(__linux__)
+                #include <sys/auxv.h>       // Required for: getauxval()
+            #endif
+        #endif
+    #endif
 #endif
 #if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
     // https://github.com/LoupVaillant/Monocypher
     #include "external/monocypher.h"        // Encryption algorithm: XChaCha20-Poly1305
     #include "external/monocypher.c"        // Encryption algorithm implementation: XChaCha20-Poly1305
 #endif
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+    // System cryptographically secure random source, required for salt/nonce generation
+    #if defined(_WIN32)
+        // NOTE: Declared here to avoid including windows.h, conflicting with raylib, bcrypt library required (-lbcrypt)
+        #if defined(_MSC_VER)
+            #pragma comment(lib, "bcrypt.lib")
+        #endif
+        #if !defined(BCRYPT_USE_SYSTEM_PREFERRED_RNG)
+            #if defined(__cplusplus)
+            extern "C" {
+            #endif
+            __declspec(dllimport) long __stdcall BCryptGenRandom(void *algorithm, unsigned char *buffer, unsigned long size, unsigned long flags);
+            #if defined(__cplusplus)
+            }
+            #endif
+        #endif
+    #elif defined(__linux__) && defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 25)))
+        #define RRES_RANDOM_GETRANDOM
+        #include <sys/random.h>             // Required for: getrandom()
+        #include <errno.h>                  // Required for: errno, EINTR
+    #endif
+#endif
+
+// SIMD instructions used to undo data filters: SSE2 (x86/x64, AVX2 checked at runtime) or NEON (ARM)
+#if !defined(RRES_FILTER_NO_SIMD)
+    #if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RRES_FILTER_SIMD_SSE2
+        #include <emmintrin.h>              // Required for: SSE2 intrinsics
+        #if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+            #define RRES_FILTER_SIMD_AVX2
+            #include <immintrin.h>          // Required for: AVX2 intrinsics
+            #if defined(_MSC_VER)
+                #include <intrin.h>         // Required for: __cpuid(), __cpuidex(), _xgetbv()
+            #endif
+        #endif
+    #elif defined(__ARM_NEON) || defined(__aarch64__)
+        #define RRES_FILTER_SIMD_NEON
+        #include <arm_neon.h>               // Required for: NEON intrinsics
+    #endif
+#endif
+
+#if defined(RRES_SUPPORT_THREADS)
+    #if defined(_WIN32)
+        // Functions required to create threads on Windows
+        // NOTE: Declared here to avoid including windows.h, conflicting with raylib,
+        // windows.h declarations and types are used if it was already included
+        #if defined(_WINDOWS_)
+            typedef SRWLOCK JobPoolLock;
+            typedef CONDITION_VARIABLE JobPoolCondition;
+        #else
+            typedef void *JobPoolLock;
+            typedef void *JobPoolCondition;
+
+            #if defined(__cplusplus)
+            extern "C" {
+            #endif
+            __declspec(dllimport) void *__stdcall CreateThread(void *threadAttributes, size_t stackSize, unsigned long (__stdcall *startAddress)(void *), void *parameter, unsigned long creationFlags, unsigned long *threadId);
+            __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+            __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+            __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(JobPoolLock *srwLock);
+            __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(JobPoolLock *srwLock);
+            __declspec(dllimport) int __stdcall SleepConditionVariableSRW(JobPoolCondition *conditionVariable, JobPoolLock *srwLock, unsigned long milliseconds, unsigned long flags);
+            __declspec(dllimport) void __stdcall WakeAllConditionVariable(JobPoolCondition *conditionVariable);
+            #if defined(__cplusplus)
+            }
+            #endif
+        #endif
+    #else
+        #include <pthread.h>                // Required for: pthread_create(), pthread_join()
+        #include <unistd.h>                 // Required for: sysconf()
+    #endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-//...
+#define THREADS_MAX                     32  // Maximum threads used to unpack a resource chunk
+#define RESOURCE_CACHE_BUCKETS         256  // Resource cache hash tables buckets (power of 2)
+#define RESOURCE_CACHE_HASH(fileId, rresId) (((fileId) ^ (rresId)) & (RESOURCE_CACHE_BUCKETS - 1))    // Resource cache bucket, by file and resource id
+#define RESOURCE_CACHE_CHUNK_HASH(chunk)    ((unsigned int)((size_t)(chunk) >> 4) & (RESOURCE_CACHE_BUCKETS - 1)) // Resource cache bucket, by chunk address
+#define AES_CTR_TILE_SIZE       (16*1024)   // AES-CTR data processing tile size, MD5 is computed while tile is in cache
+#define CIPHER_SEGMENTS_FOOTER_SIZE     48  // Segmented cipher packed data footer size: salt[16] + nonce[24] + segmentSize + dataSize
+#define COMP_DICTIONARIES_MAX            8  // Maximum compression dictionaries loaded at the same time
+#define COMP_DICTIONARY_MAX_SIZE  (64*1024) // Compression dictionary maximum size, LZ4 window size
+#define COMP_DICTIONARY_SEGMENT_SIZE   256  // Compression dictionary training: candidate data segment size
+#define COMP_DICTIONARY_HASH_SIZE (64*1024) // Compression dictionary training: 8-byte sequences hash table size
+#define COMP_REPORT_MAX                 64  // Maximum compression report entries: chunk type + compression algorithm
+#define COMP_TRIAL_ITERATIONS            8  // Compression selection: maximum decompression iterations timed per codec
+#define COMP_TRIAL_TIME            2000000  // Compression selection: decompression time (ns) to stop timing iterations
+
+#define FILTER_FLAGS                0x0ffc  // Data filter flags: filters, element size and previous element distance
+#define FILTER_TILE_SIZE        (16*1024)   // Data filter shuffle tile size (multiple of 8), tiles are unshuffled in cache
+#define FILTER_ELEMENT_SIZE(flags)  (1u << (((flags) >> 5) & 0x3))     // Data filter element size (bytes): 1, 2, 4, 8
+#define FILTER_DISTANCE(flags)      ((((flags) >> 8) & 0xf) + 1)        // Data filter previous element distance (elements): 1..16
+
+// QOI image data decoding, as defined by QOI specs
+#define QOI_DATA_HEADER_SIZE            14  // QOI header size: magic + width + height + channels + colorspace
+#define QOI_DATA_PADDING_SIZE            8  // QOI end of stream padding size
+#define QOI_DATA_PIXELS_MAX      400000000  // QOI maximum pixels supported (same limit than qoi.h)
+#define QOI_TAG_INDEX                 0x00  // QOI chunk tag: pixel from index
+#define QOI_TAG_DIFF                  0x40  // QOI chunk tag: small difference from previous pixel
+#define QOI_TAG_LUMA                  0x80  // QOI chunk tag: green difference + red/blue differences relative to green
+#define QOI_TAG_RUN                   0xc0  // QOI chunk tag: run of previous pixel
+#define QOI_TAG_RGB                   0xfe  // QOI chunk tag: RGB values
+#define QOI_TAG_RGBA                  0xff  // QOI chunk tag: RGBA values
+#define QOI_TAG_MASK                  0xc0  // QOI chunk tag mask (2-bit tags)
+#define QOI_STRIPES_HEADER_SIZE         24  // QOI stripes header size: magic + width + height + channels + stripeRows + stripeCount
+
+// Data filter elements operation
+#define FILTER_MODE_NONE                 0  // Elements not filtered
+#define FILTER_MODE_ADD                  1  // Elements delta encoded, restored adding previous element
+#define FILTER_MODE_XOR                  2  // Elements XOR with previous element
+
+#define VERTEX_QUANT_PATTERN_SIZE       24  // Vertex dequantization: scale/offset pattern size (values), multiple of 1..4 components and SIMD step
+#define VERTEX_CACHE_SIZE               16  // Vertex cache optimization: post-transform vertex cache size (vertices)
+
+#define INFLATE_LITLEN_TABLE_BITS       11  // Inflate literal/length decode table bits, longer codes decoded with a subtable
+#define INFLATE_DIST_TABLE_BITS          8  // Inflate distance decode table bits, longer codes decoded with a subtable
+#define INFLATE_PRECODE_TABLE_BITS       7  // Inflate code lengths decode table bits (max code length)
+#define INFLATE_LITLEN_TABLE_SIZE (2048 + 288*16) // Inflate literal/length decode table size: main table + subtables (max 4 bits)
+#define INFLATE_DIST_TABLE_SIZE    (256 + 32*128) // Inflate distance decode table size: main table + subtables (max 7 bits)
+
+// Inflate decode table alphabets
+#define INFLATE_LITLEN                   0  // Literal/length codes: literals, end of block, match lengths
+#define INFLATE_DIST                     1  // Distance codes: match distances
+#define INFLATE_PRECODE                  2  // Code lengths codes
+
+// Inflate decode table entry: code bits consumed + extra bits (or subtable bits) + entry kind + value
+#define INFLATE_ENTRY(bits, extra, kind, value) ((unsigned int)(bits) | ((unsigned int)(extra) << 8) | ((unsigned int)(kind) << 12) | ((unsigned int)(value) << 16))
+#define INFLATE_ENTRY_BITS(entry)       ((entry) & 0xff)
+#define INFLATE_ENTRY_EXTRA(entry)      (((entry) >> 8) & 0xf)
+#define INFLATE_ENTRY_KIND(entry)       (((entry) >> 12) & 0xf)
+#define INFLATE_ENTRY_VALUE(entry)      ((entry) >> 16)
+
+// Inflate decode table entry kinds
+#define INFLATE_LITERAL                  0  // Value: literal (or code length symbol)
+#define INFLATE_LITERALS                 1  // Value: two literals (multi-symbol entry)
+#define INFLATE_BASE                     2  // Value: match length/distance base, extra bits after code
+#define INFLATE_END                      3  // End of block
+#define INFLATE_SUBTABLE                 4  // Value: subtable offset, subtable bits
+#define INFLATE_INVALID                  5  // Code not used
+
+// Parallel jobs pool synchronization: lock, wait for condition (lock released while waiting) and wake all waiting threads
+#if defined(RRES_SUPPORT_THREADS)
+    #if defined(_WIN32)
+        #define JOB_POOL_LOCK()                 AcquireSRWLockExclusive(&jobPoolLock)
+        #define JOB_POOL_UNLOCK()               ReleaseSRWLockExclusive(&jobPoolLock)
+        #define JOB_POOL_WAIT(condition)        SleepConditionVariableSRW(&condition, &jobPoolLock, 0xffffffff, 0)  // INFINITE
+        #define JOB_POOL_WAKE(condition)        WakeAllConditionVariable(&condition)
+    #else
+        #define JOB_POOL_LOCK()                 pthread_mutex_lock(&jobPoolMutex)
+        #define JOB_POOL_UNLOCK()               pthread_mutex_unlock(&jobPoolMutex)
+        #define JOB_POOL_WAIT(condition)        pthread_cond_wait(&condition, &jobPoolMutex)
+        #define JOB_POOL_WAKE(condition)        pthread_cond_broadcast(&condition)
+    #endif
+#endif
+
+// Compiler target attribute required by AES hardware instructions functions
+#if defined(RRES_AES_HARDWARE_X86) && !defined(_MSC_VER)
+    #define AES_HARDWARE_TARGET __attribute__((target("aes,sse2")))
+#elif defined(RRES_AES_HARDWARE_ARM) && defined(__clang__)
+    #define AES_HARDWARE_TARGET __attribute__((target("aes")))
+#elif defined(RRES_AES_HARDWARE_ARM)
+    #define AES_HARDWARE_TARGET __attribute__((target("+crypto")))
+#else
+    #define AES_HARDWARE_TARGET
+#endif
+
+// Compiler target attribute required by AVX2 data filters functions
+#if defined(RRES_FILTER_SIMD_AVX2) && !defined(_MSC_VER)
+    #define FILTER_AVX2_TARGET __attribute__((target("avx2")))
+#else
+    #define FILTER_AVX2_TARGET
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// MD5 hash computation context, data can be provided in multiple updates
+typedef struct MD5Context {
+    unsigned int state[4];          // Hash state: A, B, C, D
+    unsigned long long size;        // Data size processed (bytes)
+    unsigned char buffer[64];       // Data pending to be processed, not filling a 64-byte block
+} MD5Context;
+
+// Parallel job function, processes provided job index
+typedef void (*ParallelJobFunc)(void *data, unsigned int index);
+
+// Parallel jobs pool, worker threads are created on first use and kept waiting for next jobs
+// NOTE: Jobs are claimed one by one by calling thread and workers, balancing jobs with different cost
+typedef struct ParallelJobPool {
+    ParallelJobFunc func;           // Current jobs function
+    void *data;                     // Current jobs shared data
+    unsigned int count;             // Current jobs count
+    unsigned int next;              // Next job index to be claimed
+    unsigned int workers;           // Worker threads processing current jobs
+    unsigned int pending;           // Worker threads still processing current jobs
+    unsigned int generation;        // Jobs generation, incremented on every jobs submission
+    unsigned int seen[THREADS_MAX]; // Last jobs generation seen by every worker thread
+    unsigned int threadCount;       // Worker threads created
+    bool busy;                      // Pool processing jobs, concurrent submissions are processed in calling thread
+} ParallelJobPool;
+
+// Cipher data segments, shared data for parallel decryption jobs
+// NOTE: Every job processes one segment of data in place, keystream counter is offset by segment position
+typedef struct CipherSegments {
+    unsigned char *data;            // Data to be processed (in place)
+    size_t size;                    // Data size (bytes)
+    const void *aesContext;         // AES context (struct AES_ctx), AES-CTR only
+    const unsigned char *key;       // ChaCha20 key (XChaCha20 subkey), ChaCha20 only
+    const unsigned char *nonce;     // ChaCha20 nonce[8], ChaCha20 only
+    unsigned long long counter;     // ChaCha20 block counter for data start, ChaCha20 only
+} CipherSegments;
+
+// AEAD data segments, shared data for parallel segments encryption/decryption
+// NOTE: Every segment is encrypted with its own nonce (segment index XORed into base nonce last 8 bytes)
+// and its own MAC, segment index and total data size are authenticated as additional data
+typedef struct AEADSegments {
+    unsigned char *data;            // Segments data to be processed (in place), first processed segment start
+    unsigned char *macs;            // Segments MAC[16], first processed segment MAC
+    const unsigned char *key;       // Encryption key
+    unsigned char nonce[24];        // Base nonce, unique to processed data
+    unsigned int dataSize;          // Total data size, all segments (bytes)
+    unsigned int segmentSize;       // Segment size (bytes), last segment can be smaller
+    unsigned int segmentCount;      // Total segments count
+    unsigned int first;             // First processed segment index
+    int *results;                   // Processed segments decryption result: 0 on success (NULL on encryption)
+} AEADSegments;
+
+// Compressed data blocks, shared data for parallel blocks decompression
+// NOTE: Blocks not reduced by compression are stored uncompressed (block packed size equals block size)
+typedef struct DataBlocks {
+    const unsigned char *data;      // Blocks compressed data, first processed block start
+    const unsigned int *offsets;    // Blocks offsets in compressed data, first processed block offset (count + 1)
+    unsigned char *output;          // Decompressed data, first processed block start
+    const CompressionCodec *codec;  // Blocks compression codec
+    unsigned int blockSize;         // Block size (bytes), last block can be smaller
+    unsigned int dataSize;          // Total decompressed data size, all blocks (bytes)
+    unsigned int first;             // First processed block index
+    int *results;                   // Processed blocks decompression result: 0 on success
+} DataBlocks;
+
+// QOI image stripes, shared data for parallel stripes encoding/decoding
+// NOTE: Every stripe is an independent QOI image (complete rows), stripes are stacked vertically
+typedef struct ImageStripes {
+    const unsigned char *data;      // Stripes QOI data, offsets relative to it (decoding)
+    const unsigned int *offsets;    // Stripes offsets in QOI data (count + 1) (decoding)
+    unsigned char **stripes;        // Stripes QOI data, allocated by every job (encoding)
+    unsigned int *stripeSizes;      // Stripes QOI data size (encoding)
+    unsigned char *pixels;          // Image pixels: source (encoding) or output (decoding)
+    unsigned int width;             // Image width
+    unsigned int height;            // Image height
+    unsigned int channels;          // Image channels: 3 (RGB) or 4 (RGBA)
+    unsigned int stripeRows;        // Stripe rows, last stripe can be smaller
+    int *results;                   // Stripes decoding result: 0 on success (decoding)
+} ImageStripes;
+
+// Compression dictionary, shared by resource chunks packed with it
+typedef struct CompressionDictionary {
+    unsigned int id;                // Dictionary identifier (dictionary data CRC32 hash), stored in packed chunks
+    unsigned int fileId;            // Dictionary file identifier (fileName CRC32 hash), 0 if not loaded from file
+    char *fileName;                 // Dictionary file name, compared on fileId match (NULL if not loaded from file)
+    unsigned char *data;            // Dictionary data
+    unsigned int size;              // Dictionary size (bytes)
+} CompressionDictionary;
+
+// Compression dictionary training candidate segment
+typedef struct DictionarySegment {
+    unsigned int offset;            // Segment offset in training samples data
+    unsigned int size;              // Segment size (bytes)
+    unsigned int score;             // Segment score: frequency of its 8-byte sequences in other samples
+} DictionarySegment;
+
+// Compression report entry, selections accumulated per chunk type and compression algorithm
+typedef struct CompressionReportEntry {
+    unsigned char type[4];          // Chunk type (FourCC)
+    int compType;                   // Compression algorithm selected
+    unsigned int count;             // Chunks selected
+    unsigned long long baseSize;    // Chunks unpacked data size (bytes)
+    unsigned long long compSize;    // Chunks compressed data size (bytes)
+    unsigned long long decodeTime;  // Chunks decompression time (ns)
+} CompressionReportEntry;
+
+// Inflate decoder state, DEFLATE data decompression
+typedef struct InflateState {
+    const unsigned char *in;        // Input data, next byte to read
+    const unsigned char *inEnd;     // Input data end
+    const unsigned char *output;    // Output data start
+    unsigned char *out;             // Output data, next byte to write
+    unsigned char *outEnd;          // Output data end
+    unsigned long long bitBuffer;   // Bit buffer, read LSB-first
+    unsigned int bitCount;          // Bit buffer available bits
+    unsigned int overrun;           // Zero bytes added to bit buffer past input end
+    unsigned int litlenTable[INFLATE_LITLEN_TABLE_SIZE]; // Literal/length decode table (main table + subtables)
+    unsigned int distTable[INFLATE_DIST_TABLE_SIZE];     // Distance decode table (main table + subtables)
+    unsigned int precodeTable[1 << INFLATE_PRECODE_TABLE_BITS]; // Code lengths decode table
+} InflateState;
+
+// Resource cache entry
+// NOTE: Entries are allocated one by one to keep returned chunk pointers valid, linked in two hash tables
+// (by file and resource id for requests, by chunk address for releases) and, while not referenced,
+// in the cache LRU list (most recently released first)
+typedef struct ResourceCacheEntry {
+    unsigned int fileId;            // Resource file identifier (fileName CRC32 hash)
+    char *fileName;                 // Resource file name, compared on fileId match (hash collisions)
+    unsigned int rresId;            // Resource chunk identifier
+    rresResourceChunk chunk;        // Resource chunk, unpacked
+    unsigned int size;              // Resource chunk memory size (bytes)
+    int refCount;                   // Resource chunk references in use
+    struct ResourceCacheEntry *nextHash;    // Next entry in hash bucket, by file and resource id
+    struct ResourceCacheEntry *nextChunk;   // Next entry in hash bucket, by chunk address
+    struct ResourceCacheEntry *prevUnused;  // Previous entry in LRU list (more recently released), only if not referenced
+    struct ResourceCacheEntry *nextUnused;  // Next entry in LRU list (less recently released), only if not referenced
+} ResourceCacheEntry;
+
+// Cipher key cache entry
+typedef struct CipherKeyCacheEntry {
+    unsigned char passHash[32];     // Password hash (BLAKE2b), password is not stored
+    unsigned char salt[16];         // Key stretching salt
+    unsigned char key[32];          // Derived key
+    unsigned int lastUse;           // Key last use tick, required for LRU replacement (0 if entry not used)
+} CipherKeyCacheEntry;
+
+// Resource cache
+typedef struct ResourceCache {
+    ResourceCacheEntry *buckets[RESOURCE_CACHE_BUCKETS]; // Cached entries hash table, by file and resource id
+    ResourceCacheEntry *chunkBuckets[RESOURCE_CACHE_BUCKETS]; // Cached entries hash table, by chunk address
+    ResourceCacheEntry *unusedHead; // LRU list of entries not referenced: most recently released
+    ResourceCacheEntry *unusedTail; // LRU list of entries not referenced: least recently released, evicted first
+    ResourceCacheStats stats;       // Cache stats
+} ResourceCache;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 static const char *baseDir = NULL;      // Base directory pointer, used on external linked data loading
+static ResourceCache cache = { 0 };     // Resource chunks cache
+static unsigned int cacheBudget = RRES_RESOURCE_CACHE_BUDGET; // Resource chunks cache memory budget (bytes)
+static int unpackThreads = 0;           // Threads used to unpack large chunks (0: CPU cores available)
+static unsigned int compBlockSize = 0;  // Block size for data compression in independent blocks (0: one stream)
+static CompressionDictionary compDictionaries[COMP_DICTIONARIES_MAX] = { 0 }; // Compression dictionaries loaded
+static unsigned int compDictionaryCount = 0; // Compression dictionaries count
+static int compDictionary = -1;         // Compression dictionary used on packing (-1: no dictionary)
+static CompressionCodec compCodecs[256] = { 0 };        // Compression codecs registered, by compType
+static EncryptionCipher encryptionCiphers[256] = { 0 }; // Encryption ciphers registered, by cipherType
+static bool codecsLoaded = false;       // Built-in codecs and ciphers registered
+static int compPolicy = COMPRESSION_POLICY_SIZE; // Compression policy used by SelectCompressionType()
+static float compMinDecodeSpeed = 0.0f; // Compression policy minimum decompression speed (MB/s), COMPRESSION_POLICY_BUDGET
+static CompressionReportEntry compReport[COMP_REPORT_MAX] = { 0 }; // Compression selections report
+static unsigned int compReportCount = 0; // Compression selections report entries
+
+#if defined(RRES_SUPPORT_THREADS)
+static ParallelJobPool jobPool = { 0 }; // Parallel jobs pool, shared by all unpacking functions
+#if defined(_WIN32)
+static JobPoolLock jobPoolLock = { 0 };                        // Parallel jobs pool lock (SRWLOCK)
+static JobPoolCondition jobPoolStart = { 0 };                  // Parallel jobs pool condition: jobs submitted (CONDITION_VARIABLE)
+static JobPoolCondition jobPoolDone = { 0 };                   // Parallel jobs pool condition: workers done (CONDITION_VARIABLE)
+#else
+static pthread_mutex_t jobPoolMutex = PTHREAD_MUTEX_INITIALIZER;   // Parallel jobs pool lock
+static pthread_cond_t jobPoolStart = PTHREAD_COND_INITIALIZER;     // Parallel jobs pool condition: jobs submitted
+static pthread_cond_t jobPoolDone = PTHREAD_COND_INITIALIZER;      // Parallel jobs pool condition: workers done
+#endif
+#endif
+
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+static CipherKeyCacheEntry cipherKeys[RRES_CIPHER_KEY_CACHE_SIZE] = { 0 }; // Cipher keys cache
+static unsigned int cipherKeysTick = 0; // Cipher keys cache current use tick
+static unsigned char cipherSalt[16] = { 0 }; // Salt shared by all packed chunks
+static bool cipherSaltShared = false;   // Use shared salt on packing
+#endif
+#if defined(RRES_FILTER_SIMD_AVX2)
+static int filterAVX2 = -1;             // AVX2 instructions supported (data filters, vertex dequantization): -1 (not checked yet), 0 (no), 1 (yes)
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+static int aesHardware = -1;            // AES hardware instructions supported: -1 (not checked yet), 0 (no), 1 (yes)
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
@@ -165,10 +772,159 @@ static const char *baseDir = NULL;      // Base directory pointer, used on exter
 static void *LoadDataFromResourceLink(rresResourceChunk chunk, unsigned int *size);      // Load chunk: RRES_DATA_LINK
 static void *LoadDataFromResourceChunk(rresResourceChunk chunk, unsigned int *size);     // Load chunk: RRES_DATA_RAW
 static char *LoadTextFromResourceChunk(rresResourceChunk chunk, unsigned int *codeLang); // Load chunk: RRES_DATA_TEXT
-static Image LoadImageFromResourceChunk(rresResourceChunk chunk);                        // Load chunk: RRES_DATA_IMAGE
+static Image LoadImageFromResourceChunk(rresResourceChunk chunk, bool moveData);         // Load chunk: RRES_DATA_IMAGE (image data can take chunk data)
+static Mesh LoadMeshFromResourceChunks(rresResourceMulti multi, bool moveData);          // Load chunks: RRES_DATA_VERTEX (mesh arrays can take chunks data)
+static void *LoadResourceChunkRaw(rresResourceChunk *chunk, unsigned int size, bool moveData); // Load chunk raw data: moved or copied, size must fit chunk data
+static bool UnpackResourceChunkConsume(rresResourceChunk *chunk);                       // Unpack chunk to be consumed (if required), chunk data size checked
+static bool IsImageChunkQOI(rresResourceChunk chunk);                                   // Check chunk is a QOI compressed image, directly decoded into image data
+static bool LoadVertexBufferLayout(rresResourceChunk chunk, VertexBuffer *buffer);      // Load interleaved vertex data layout from chunk props, layout and data size checked
+static void LoadMeshVertexBuffer(Mesh *mesh, VertexBuffer buffer);                      // Load Mesh arrays from interleaved vertex data, raylib supported attributes de-interleaved
+static void *GetMeshAttribute(Mesh mesh, unsigned int attribute, unsigned int *componentCount, unsigned int *format); // Get Mesh array for vertex attribute and its raylib expected layout
+static void SetMeshAttribute(Mesh *mesh, unsigned int attribute, void *array);          // Set Mesh array for vertex attribute
+static unsigned int GetVertexFormatSize(unsigned int format);                           // Get vertex format component size (bytes), 0 if not valid
+static bool IsVertexFormatFloat(unsigned int format);                                   // Check vertex format is float or quantized float (expanded to float on loading)
+static float *LoadVertexAttributeFloat(rresResourceChunk *chunk, unsigned int vertexCount, bool moveData); // Load vertex attribute as float array, quantized data expanded to float
+static unsigned int *LoadIndicesFromResourceChunk(rresResourceChunk *chunk, unsigned int *count, bool moveData); // Load vertex indices as 32-bit values, 32-bit indices can take chunk data
+static bool OptimizeVertexCache(unsigned int *indices, unsigned int indexCount, unsigned int vertexCount); // Reorder triangles for post-transform vertex cache locality (Tipsify), indices reordered in place
 
 static const char *GetExtensionFromProps(unsigned int ext01, unsigned int ext02);        // Get file extension from RRES_DATA_RAW properties (unsigned int)
 
+static void EvictResourceCache(unsigned int budget);                                    // Evict unreferenced cached chunks (LRU) until cache fits budget
+static void LinkResourceCacheUnused(ResourceCacheEntry *entry);                         // Add cache entry to LRU list, as most recently released
+static void UnlinkResourceCacheUnused(ResourceCacheEntry *entry);                       // Remove cache entry from LRU list
+static char *CopyFileName(const char *fileName);                                        // Copy file name string, required to identify file on hash match
+
+static unsigned int GetUnpackThreadCount(void);                                         // Get threads used to unpack large chunks (1 if threads not supported)
+static void RunParallelJobs(ParallelJobFunc func, void *data, unsigned int count);      // Run jobs [0..count-1], distributed in multiple threads
+#if defined(RRES_SUPPORT_THREADS)
+static bool StartJobPoolThread(unsigned int index);                                     // Start parallel jobs pool worker thread
+static void ProcessPoolJobs(void);                                                      // Process pool jobs until all claimed, pool lock must be held
+#if defined(_WIN32)
+static unsigned long __stdcall ParallelJobThread(void *arg);                            // Parallel jobs worker thread entry point (Win32)
+#else
+static void *ParallelJobThread(void *arg);                                              // Parallel jobs worker thread entry point (pthreads)
+#endif
+#endif
+
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+static void DeriveCipherKey(unsigned char *key, const unsigned char *salt);             // Derive encryption key from password and salt (Argon2i, 256 bit), cached
+static bool GetRandomBytes(unsigned char *buffer, unsigned int size);                   // Get random bytes for salt/nonce generation, system random source required
+#endif
+
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+static int DecryptXChaCha20Poly1305(unsigned char *data, size_t size, const unsigned char *key, const unsigned char *nonce, const unsigned char *mac); // Decrypt data in place (XChaCha20-Poly1305), MAC verified before decryption
+static void ProcessChaCha20Segment(void *data, unsigned int index);                     // Parallel job: ChaCha20 keystream applied to one data segment
+static bool LoadAEADSegmentsFooter(AEADSegments *segments, unsigned char *salt, const unsigned char *footer, unsigned int packedSize); // Load segmented cipher footer: salt, nonce and segments layout, returns false if not valid
+static int ProcessAEADSegments(AEADSegments *segments, unsigned int count, bool decrypt); // Encrypt/decrypt segments in place (XChaCha20-Poly1305), data is not modified if decryption fails
+static void ProcessAEADSegment(void *data, unsigned int index);                         // Parallel job: XChaCha20-Poly1305 applied to one data segment
+#endif
+
+static void LoadDefaultCodecs(void);                                                     // Register built-in compression codecs and encryption ciphers (if supported)
+static const CompressionCodec *GetCompressionCodec(int compType);                       // Get compression codec registered for compType, NULL if not supported
+static const EncryptionCipher *GetEncryptionCipher(int cipherType);                     // Get encryption cipher registered for cipherType, NULL if not supported
+static unsigned long long MeasureDecompressTime(const unsigned char *compData, unsigned int compSize, const CompressionCodec *codec, bool compBlocks, const CompressionDictionary *dictionary, const unsigned char *data, unsigned int size); // Measure data decompression time (ns), 0 if decompressed data does not match
+static unsigned char *CompressDataDEFLATE(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned int *compSize); // Compression codec: DEFLATE
+#if defined(RRES_DEFLATE_USE_RAYLIB)
+static unsigned char *DecompressDataDEFLATE(const unsigned char *data, unsigned int size, unsigned int *dataSize); // Compression codec: DEFLATE (raylib)
+#else
+static bool DecompressDataInflate(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned char *output, unsigned int outputSize); // Compression codec: DEFLATE (bundled inflate)
+static void RefillInflateBits(InflateState *state);                                     // Refill inflate bit buffer, at least 56 bits available
+static bool InflateStoredBlock(InflateState *state);                                    // Inflate stored block (uncompressed)
+static bool InflateHuffmanBlock(InflateState *state);                                   // Inflate block compressed with Huffman codes, decode tables must be loaded
+static bool LoadInflateFixedTables(InflateState *state);                                // Load inflate decode tables for fixed Huffman codes
+static bool LoadInflateDynamicTables(InflateState *state);                              // Load inflate decode tables for dynamic Huffman codes (read from block header)
+static bool BuildInflateTable(unsigned int *table, unsigned int tableBits, const unsigned char *lengths, unsigned int count, int alphabet, bool literalPairs); // Build inflate decode table from code lengths
+#endif
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+static unsigned char *CompressDataLZ4(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned int *compSize); // Compression codec: LZ4
+static bool DecompressDataLZ4(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned char *output, unsigned int outputSize); // Compression codec: LZ4
+#endif
+static unsigned char *CompressDataQOI(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned int *compSize); // Compression codec: QOI, image pixels only
+static bool DecompressDataQOI(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned char *output, unsigned int outputSize); // Compression codec: QOI, image props reconstructed
+static bool LoadQOIHeader(const unsigned char *data, unsigned int size, unsigned int *width, unsigned int *height, unsigned int *channels); // Load QOI image header: width, height and channels
+static bool DecodeImageQOI(const unsigned char *data, unsigned int size, unsigned char *pixels, unsigned int pixelsSize); // Decode QOI image pixels into provided buffer (one stream or stripes)
+static bool DecodePixelsQOI(const unsigned char *data, unsigned int size, unsigned char *pixels, unsigned int pixelsSize); // Decode QOI image pixels, one stream
+static void EncodeStripeQOI(void *data, unsigned int index);                           // Parallel job: Encode one QOI image stripe
+static void DecodeStripeQOI(void *data, unsigned int index);                           // Parallel job: Decode one QOI image stripe
+static unsigned char *CompressDataIndices(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned int *compSize); // Compression codec: index data, delta + zigzag + varint
+static bool DecompressDataIndices(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned char *output, unsigned int outputSize); // Compression codec: index data, delta + zigzag + varint
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+static unsigned char *EncryptDataAES(const unsigned char *data, unsigned int size, unsigned int *packedSize); // Encryption cipher: AES
+static bool DecryptDataAES(unsigned char *data, unsigned int size, unsigned int *dataSize); // Encryption cipher: AES
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+static unsigned char *EncryptDataXChaCha20(const unsigned char *data, unsigned int size, unsigned int *packedSize); // Encryption cipher: XChaCha20-Poly1305
+static bool DecryptDataXChaCha20(unsigned char *data, unsigned int size, unsigned int *dataSize); // Encryption cipher: XChaCha20-Poly1305
+static unsigned char *EncryptDataXChaCha20Segments(const unsigned char *data, unsigned int size, unsigned int *packedSize); // Encryption cipher: XChaCha20-Poly1305 segmented
+static bool DecryptDataXChaCha20Segments(unsigned char *data, unsigned int size, unsigned int *dataSize); // Encryption cipher: XChaCha20-Poly1305 segmented
+static bool LoadDecryptedRangeXChaCha20Segments(const char *fileName, rresResourceChunkInfo info, unsigned int offset, unsigned int size, unsigned char *buffer); // Encryption cipher: XChaCha20-Poly1305 segmented, random access
+#endif
+
+static bool LoadDecryptedDataRange(const char *fileName, rresResourceChunkInfo info, unsigned int offset, unsigned int size, unsigned char *buffer); // Load chunk data range from file, decrypted (if required)
+static bool LoadUnpackedDataRange(const char *fileName, rresResourceChunkInfo info, unsigned int offset, unsigned int size, unsigned char *buffer);  // Load chunk data range from file, decrypted and decompressed (if required)
+
+static unsigned char *LoadPackingData(const rresResourceChunk *chunk);                 // Load chunk data to be packed, as stored in rres file: propCount + props[] + raw (filtered, if requested)
+static unsigned char *CompressDataBlocks(const unsigned char *data, unsigned int size, const CompressionCodec *codec, unsigned int blockSize, unsigned int *compDataSize); // Compress data in independent blocks, blocks index stored before blocks data
+static bool DecompressDataBlocks(const unsigned char *packedData, unsigned int packedSize, const CompressionCodec *codec, unsigned char *output, unsigned int outputSize); // Decompress data blocks into output, output size must match blocks data size
+static bool ProcessDataBlocks(DataBlocks *blocks, unsigned int count);                 // Decompress data blocks, from blocks->first
+static void DecompressDataBlock(void *data, unsigned int index);                        // Parallel job: Decompress one data block
+static int AddCompressionDictionary(const unsigned char *data, unsigned int size, const char *fileName); // Add compression dictionary (if not loaded), returns dictionary index (-1 on failure)
+static void SetCompressionDictionaryFile(CompressionDictionary *dictionary, const char *fileName); // Set compression dictionary source file: fileId and fileName copy
+static const CompressionDictionary *GetCompressionDictionary(unsigned int id);          // Get compression dictionary for provided id, NULL if not loaded
+static unsigned int HashDictionarySequence(const unsigned char *data);                  // Get hash table index for an 8-byte sequence
+static unsigned int ScoreDictionarySegment(const unsigned char *data, unsigned int size, const unsigned int *counts); // Get dictionary segment score, from 8-byte sequences counts
+static int CompareDictionarySegments(const void *a, const void *b);                     // Compare dictionary segments by score (descending), for qsort()
+
+static bool IsDataFilterValid(unsigned int flags);                                      // Check data filter flags are valid: one element filter at most (delta or XOR)
+static void FilterData(unsigned char *data, unsigned int size, unsigned int flags);     // Apply data filters in place: elements delta/XOR encoded, then element bytes shuffled by tiles
+static void UnfilterData(unsigned char *output, const unsigned char *data, unsigned int size, unsigned int flags); // Undo data filters, filtered data is restored into output
+static void UnshuffleTile(unsigned char *output, const unsigned char *tile, unsigned int size, unsigned int elementSize); // Unshuffle tile bytes: byte planes interleaved into elements
+static void UndoElementsFilter(unsigned char *data, unsigned int start, unsigned int end, unsigned int elementSize, unsigned int stride, int mode); // Undo elements filter (delta/XOR) in place
+#if defined(RRES_FILTER_SIMD_SSE2)
+static unsigned int UnshuffleTileSSE2(unsigned char *output, const unsigned char *tile, unsigned int count, unsigned int elementSize, unsigned int start); // Unshuffle tile bytes using SSE2 instructions
+static unsigned int UndoElementsFilterSSE2(unsigned char *data, unsigned int start, unsigned int end, unsigned int elementSize, unsigned int stride, int mode); // Undo elements filter using SSE2 instructions
+#endif
+#if defined(RRES_FILTER_SIMD_AVX2)
+static bool IsAVX2Supported(void);                                                      // Check AVX2 instructions support (runtime)
+FILTER_AVX2_TARGET static unsigned int UnshuffleTileAVX2(unsigned char *output, const unsigned char *tile, unsigned int count, unsigned int elementSize); // Unshuffle tile bytes using AVX2 instructions
+#endif
+#if defined(RRES_FILTER_SIMD_NEON)
+static unsigned int UnshuffleTileNEON(unsigned char *output, const unsigned char *tile, unsigned int count, unsigned int elementSize); // Unshuffle tile bytes using NEON instructions
+static unsigned int UndoElementsFilterNEON(unsigned char *data, unsigned int start, unsigned int end, unsigned int elementSize, unsigned int stride, int mode); // Undo elements filter using NEON instructions
+#endif
+
+static void DequantizeVertexData(float *output, const unsigned char *data, unsigned int vertexCount, unsigned int componentCount, unsigned int format, const float *scale, const float *offset, unsigned int stride); // Expand quantized vertex data to float: normalized*scale + offset
+static float HalfToFloat(unsigned short value);                                         // Convert half-float value to float
+static unsigned short FloatToHalf(float value);                                         // Convert float value to half-float (round to nearest even)
+#if defined(RRES_FILTER_SIMD_SSE2)
+static unsigned int DequantizeVertexDataSSE2(float *output, const unsigned char *data, unsigned int count, unsigned int format, const float *scale, const float *offset); // Expand quantized vertex values to float using SSE2 instructions
+#endif
+#if defined(RRES_FILTER_SIMD_AVX2)
+FILTER_AVX2_TARGET static unsigned int DequantizeVertexDataAVX2(float *output, const unsigned char *data, unsigned int count, unsigned int format, const float *scale, const float *offset); // Expand quantized vertex values to float using AVX2 instructions
+#endif
+#if defined(RRES_FILTER_SIMD_NEON)
+static unsigned int DequantizeVertexDataNEON(float *output, const unsigned char *data, unsigned int count, unsigned int format, const float *scale, const float *offset); // Expand quantized vertex values to float using NEON instructions
+#endif
+
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+static void ProcessAES_CTR_Segment(void *data, unsigned int index);                     // Parallel job: AES-CTR keystream applied to one data segment
+static void ProcessAES_CTR(const struct AES_ctx *ctx, unsigned char *data, size_t size, unsigned long long block); // Encrypt/decrypt data in place (AES-CTR), from provided counter block
+static void ProcessAES_CTR_MD5(const struct AES_ctx *ctx, unsigned char *data, size_t size, bool decrypt, unsigned char *md5); // Encrypt/decrypt data in place (AES-CTR), computing plain data MD5 in the same pass
+static bool IsAESHardwareSupported(void);                                              // Check AES hardware instructions support (runtime)
+#if defined(RRES_AES_HARDWARE_X86)
+AES_HARDWARE_TARGET static void ProcessAES_CTR_NI(const struct AES_ctx *ctx, unsigned char *data, size_t size, unsigned long long block); // AES-CTR using AES-NI instructions
+AES_HARDWARE_TARGET static __m128i GetCounterBlockNI(unsigned long long block);         // Get AES-CTR counter block for block index: 128-bit big-endian
+#endif
+#if defined(RRES_AES_HARDWARE_ARM)
+AES_HARDWARE_TARGET static void ProcessAES_CTR_ARMv8(const struct AES_ctx *ctx, unsigned char *data, size_t size, unsigned long long block); // AES-CTR using ARMv8 Crypto Extensions
+#endif
+
+static void InitMD5(MD5Context *md5);                                                   // Init MD5 hash computation
+static void UpdateMD5(MD5Context *md5, const unsigned char *data, size_t size);          // Update MD5 hash with provided data
+static void FinalMD5(MD5Context *md5, unsigned char *hash);                             // Finish MD5 hash computation, hash[16]
+static void ProcessMD5Block(unsigned int *state, const unsigned char *block);           // Process one 64-byte block of MD5 data
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -177,6 +933,7 @@ static const char *GetExtensionFromProps(unsigned int ext01, unsigned int ext02)
 void *LoadDataFromResource(rresResourceChunk chunk, unsigned int *size)
 {
     void *rawData = NULL;
+    RRES_TRACE_BEGIN(convertSpan);
 
     // Data can be provided in the resource or linked to an external file
     if (rresGetDataType(chunk.info.type) == RRES_DATA_RAW)       // Raw data
@@ -193,6 +950,8 @@ void *LoadDataFromResource(rresResourceChunk chunk, unsigned int *size)
         *size = dataSize;
     }
 
+    RRES_TRACE_END(RRES_TRACE_CONVERT, chunk.info.id, chunk.info.type, convertSpan);
+
     return rawData;
 }
 
@@ -202,6 +961,7 @@ char *LoadTextFromResource(rresResourceChunk chunk)
 {
     char *text = NULL;
     unsigned int codeLang = 0;
+    RRES_TRACE_BEGIN(convertSpan);
 
     if (rresGetDataType(chunk.info.type) == RRES_DATA_TEXT)       // Text data
     {
@@ -222,6 +982,8 @@ char *LoadTextFromResource(rresResourceChunk chunk)
         text = (char *)data;
     }
 
+    RRES_TRACE_END(RRES_TRACE_CONVERT, chunk.info.id, chunk.info.type, convertSpan);
+
     return text;
 }
 
@@ -229,10 +991,11 @@ char *LoadTextFromResource(rresResourceChunk chunk)
 Image LoadImageFromResource(rresResourceChunk chunk)
 {
     Image image = { 0 };
+    RRES_TRACE_BEGIN(convertSpan);
 
     if (rresGetDataType(chunk.info.type) == RRES_DATA_IMAGE)          // Image data
     {
-        image = LoadImageFromResourceChunk(chunk);
+        image = LoadImageFromResourceChunk(chunk, false);
     }
     else if (rresGetDataType(chunk.info.type) == RRES_DATA_RAW)       // Raw image file
     {
@@ -255,6 +1018,8 @@ Image LoadImageFromResource(rresResourceChunk chunk)
         image = LoadImageFromMemory(GetFileExtension((char *)chunk.data.raw), (unsigned char *)data, dataSize);
     }
 
+    RRES_TRACE_END(RRES_TRACE_CONVERT, chunk.info.id, chunk.info.type, convertSpan);
+
     return image;
 }
 
@@ -262,6 +1027,7 @@ Image LoadImageFromResource(rresResourceChunk chunk)
 Wave LoadWaveFromResource(rresResourceChunk chunk)
 {
     Wave wave = { 0 };
+    RRES_TRACE_BEGIN(convertSpan);
 
     if (rresGetDataType(chunk.info.type) == RRES_DATA_WAVE)       // Wave data
     {
@@ -299,6 +1065,8 @@ Wave LoadWaveFromResource(rresResourceChunk chunk)
         wave = LoadWaveFromMemory(GetFileExtension((char *)chunk.data.raw), (unsigned char *)data, dataSize);
     }
 
+    RRES_TRACE_END(RRES_TRACE_CONVERT, chunk.info.id, chunk.info.type, convertSpan);
+
     return wave;
 }
 
@@ -306,6 +1074,7 @@ Wave LoadWaveFromResource(rresResourceChunk chunk)
 Font LoadFontFromResource(rresResourceMulti multi)
 {
     Font font = { 0 };
+    RRES_TRACE_BEGIN(convertSpan);
 
     // Font resource consist of (2) chunks:
     //  - RRES_DATA_FONT_GLYPHS: Basic font and glyphs properties/data
@@ -348,7 +1117,7 @@ Font LoadFontFromResource(rresResourceMulti multi)
         {
             if ((multi.chunks[0].info.compType == RRES_COMP_NONE) && (multi.chunks[0].info.cipherType == RRES_CIPHER_NONE))
             {
-                Image image = LoadImageFromResourceChunk(multi.chunks[1]);
+                Image image = LoadImageFromResourceChunk(multi.chunks[1], false);
                 font.texture = LoadTextureFromImage(image);
                 UnloadImage(image);
             }
@@ -382,6 +1151,8 @@ Font LoadFontFromResource(rresResourceMulti multi)
         }
     }
 
+    RRES_TRACE_END(RRES_TRACE_CONVERT, (multi.count > 0)? multi.chunks[0].info.id : 0, (multi.count > 0)? multi.chunks[0].info.type : NULL, convertSpan);
+
     return font;
 }
 
@@ -390,588 +1161,5544 @@ Font LoadFontFromResource(rresResourceMulti multi)
 // in case data does not fit raylib Mesh structure, it is not loaded
 Mesh LoadMeshFromResource(rresResourceMulti multi)
 {
-    Mesh mesh = { 0 };
+    RRES_TRACE_BEGIN(convertSpan);
+    Mesh mesh = LoadMeshFromResourceChunks(multi, false);
+    RRES_TRACE_END(RRES_TRACE_CONVERT, (multi.count > 0)? multi.chunks[0].info.id : 0, (multi.count > 0)? multi.chunks[0].info.type : NULL, convertSpan);
 
-    // TODO: Support externally linked mesh resource?
+    return mesh;
+}
 
-    // Mesh resource consist of (n) chunks:
-    for (unsigned int i = 0; i < multi.count; i++)
+// Load raw data from rres resource, chunk consumed
+void *LoadDataFromResourceConsume(rresResourceChunk chunk, unsigned int *size)
+{
+    void *rawData = NULL;
+
+    if (UnpackResourceChunkConsume(&chunk))
     {
-        if ((multi.chunks[0].info.compType == RRES_COMP_NONE) && (multi.chunks[0].info.cipherType == RRES_CIPHER_NONE))
+        if ((rresGetDataType(chunk.info.type) == RRES_DATA_RAW) && (chunk.data.propCount > 0))
         {
-            // NOTE: raylib only supports vertex arrays with same vertex count,
-            // rres.chunks[0] defined vertexCount will be the reference for the following chunks
-            // The only exception to vertexCount is the mesh.indices array
-            if (mesh.vertexCount == 0) mesh.vertexCount = multi.chunks[0].data.props[0];
+            RRES_TRACE_BEGIN(convertSpan);
+            rawData = LoadResourceChunkRaw(&chunk, chunk.data.props[0], true);
+            *size = (rawData != NULL)? chunk.data.props[0] : 0;
+            RRES_TRACE_END(RRES_TRACE_CONVERT, chunk.info.id, chunk.info.type, convertSpan);
+        }
+        else rawData = LoadDataFromResource(chunk, size);
+    }
 
-            // Verify chunk type and vertex count
-            if (rresGetDataType(multi.chunks[i].info.type) == RRES_DATA_VERTEX)
+    rresUnloadResourceChunk(chunk);
+
+    return rawData;
+}
+
+// Load text data from rres resource, chunk consumed
+// NOTE: Chunk data is reallocated to add NULL terminator (usually in place, no copy)
+char *LoadTextFromResourceConsume(rresResourceChunk chunk)
+{
+    char *text = NULL;
+
+    if (UnpackResourceChunkConsume(&chunk))
+    {
+        if ((rresGetDataType(chunk.info.type) == RRES_DATA_TEXT) && (chunk.data.propCount > 0))
+        {
+            RRES_TRACE_BEGIN(convertSpan);
+            unsigned int size = chunk.data.props[0];
+            char *data = (char *)LoadResourceChunkRaw(&chunk, size, true);
+
+            if (data != NULL)
             {
-                // In case vertex count do not match we skip that resource chunk
-                if ((multi.chunks[i].data.props[1] != RRES_VERTEX_ATTRIBUTE_INDEX) && (multi.chunks[i].data.props[0] != (unsigned int)mesh.vertexCount)) continue;
+                text = (char *)RL_REALLOC(data, (size_t)size + 1);
 
-                // NOTE: We are only loading raylib supported rresVertexFormat and raylib expected components count
-                switch (multi.chunks[i].data.props[1])    // Check rresVertexAttribute value
-                {
-                    case RRES_VERTEX_ATTRIBUTE_POSITION:
-                    {
-                        // raylib expects 3 components per vertex and float vertex format
-                        if ((multi.chunks[i].data.props[2] == 3) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_FLOAT))
-                        {
-                            mesh.vertices = (float *)RL_CALLOC(mesh.vertexCount*3, sizeof(float));
-                            memcpy(mesh.vertices, multi.chunks[i].data.raw, mesh.vertexCount*3*sizeof(float));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute position not valid, componentCount/vertexFormat do not fit\n");
+                if (text != NULL) text[size] = '\0';
+                else RL_FREE(data);
+            }
+            RRES_TRACE_END(RRES_TRACE_CONVERT, chunk.info.id, chunk.info.type, convertSpan);
+        }
+        else text = LoadTextFromResource(chunk);
+    }
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD1:
-                    {
-                        // raylib expects 2 components per vertex and float vertex format
-                        if ((multi.chunks[i].data.props[2] == 2) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_FLOAT))
-                        {
-                            mesh.texcoords = (float *)RL_CALLOC(mesh.vertexCount*2, sizeof(float));
-                            memcpy(mesh.texcoords, multi.chunks[i].data.raw, mesh.vertexCount*2*sizeof(float));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord1 not valid, componentCount/vertexFormat do not fit\n");
+    rresUnloadResourceChunk(chunk);
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD2:
-                    {
-                        // raylib expects 2 components per vertex and float vertex format
-                        if ((multi.chunks[i].data.props[2] == 2) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_FLOAT))
-                        {
-                            mesh.texcoords2 = (float *)RL_CALLOC(mesh.vertexCount*2, sizeof(float));
-                            memcpy(mesh.texcoords2, multi.chunks[i].data.raw, mesh.vertexCount*2*sizeof(float));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord2 not valid, componentCount/vertexFormat do not fit\n");
+    return text;
+}
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD3:
-                    {
-                        RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord3 not supported\n");
+// Load Image data from rres resource, chunk consumed
+// NOTE: QOI compressed chunks (not encrypted) are not unpacked, they are directly decoded into image data
+Image LoadImageFromResourceConsume(rresResourceChunk chunk)
+{
+    Image image = { 0 };
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD4:
-                    {
-                        RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord4 not supported\n");
+    if ((rresGetDataType(chunk.info.type) == RRES_DATA_IMAGE) && IsImageChunkQOI(chunk)) image = LoadImageFromResource(chunk);
+    else if (UnpackResourceChunkConsume(&chunk))
+    {
+        if ((rresGetDataType(chunk.info.type) == RRES_DATA_IMAGE) && (chunk.data.propCount >= 4))
+        {
+            RRES_TRACE_BEGIN(convertSpan);
+            void *rawData = chunk.data.raw;
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_NORMAL:
-                    {
-                        // raylib expects 3 components per vertex and float vertex format
-                        if ((multi.chunks[i].data.props[2] == 3) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_FLOAT))
-                        {
-                            mesh.normals = (float *)RL_CALLOC(mesh.vertexCount*3, sizeof(float));
-                            memcpy(mesh.normals, multi.chunks[i].data.raw, mesh.vertexCount*3*sizeof(float));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute normal not valid, componentCount/vertexFormat do not fit\n");
+            image = LoadImageFromResourceChunk(chunk, true);
+            if ((image.data != NULL) && (image.data == rawData)) chunk.data.raw = NULL;     // Data moved to image
+            RRES_TRACE_END(RRES_TRACE_CONVERT, chunk.info.id, chunk.info.type, convertSpan);
+        }
+        else image = LoadImageFromResource(chunk);
+    }
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_TANGENT:
-                    {
-                        // raylib expects 4 components per vertex and float vertex format
-                        if ((multi.chunks[i].data.props[2] == 4) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_FLOAT))
-                        {
-                            mesh.tangents = (float *)RL_CALLOC(mesh.vertexCount*4, sizeof(float));
-                            memcpy(mesh.tangents, multi.chunks[i].data.raw, mesh.vertexCount*4*sizeof(float));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute tangent not valid, componentCount/vertexFormat do not fit\n");
+    rresUnloadResourceChunk(chunk);
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_COLOR:
-                    {
-                        // raylib expects 4 components per vertex and unsigned char vertex format
-                        if ((multi.chunks[i].data.props[2] == 4) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_UBYTE))
-                        {
-                            mesh.colors = (unsigned char *)RL_CALLOC(mesh.vertexCount*4, sizeof(unsigned char));
-                            memcpy(mesh.colors, multi.chunks[i].data.raw, mesh.vertexCount*4*sizeof(unsigned char));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute color not valid, componentCount/vertexFormat do not fit\n");
+    return image;
+}
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_INDEX:
-                    {
-                        // raylib expects 1 components per index and unsigned short vertex format
-                        if ((multi.chunks[i].data.props[2] == 1) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_USHORT))
-                        {
-                            mesh.indices = (unsigned short *)RL_CALLOC(multi.chunks[i].data.props[0], sizeof(unsigned short));
-                            memcpy(mesh.indices, multi.chunks[i].data.raw, multi.chunks[i].data.props[0]*sizeof(unsigned short));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute index not valid, componentCount/vertexFormat do not fit\n");
+// Load Wave data from rres resource, chunk consumed
+Wave LoadWaveFromResourceConsume(rresResourceChunk chunk)
+{
+    Wave wave = { 0 };
 
-                    } break;
-                    default: break;
-                }
+    if (UnpackResourceChunkConsume(&chunk))
+    {
+        if ((rresGetDataType(chunk.info.type) == RRES_DATA_WAVE) && (chunk.data.propCount >= 4))
+        {
+            RRES_TRACE_BEGIN(convertSpan);
+            unsigned long long size = (unsigned long long)chunk.data.props[0]*chunk.data.props[2]*chunk.data.props[3]/8;
+
+            if (size <= 0xffffffff) wave.data = LoadResourceChunkRaw(&chunk, (unsigned int)size, true);
+
+            if (wave.data != NULL)
+            {
+                wave.frameCount = chunk.data.props[0];
+                wave.sampleRate = chunk.data.props[1];
+                wave.sampleSize = chunk.data.props[2];
+                wave.channels = chunk.data.props[3];
             }
+            RRES_TRACE_END(RRES_TRACE_CONVERT, chunk.info.id, chunk.info.type, convertSpan);
         }
-        else RRES_LOG("RRES: WARNING: Vertex provided data must be decompressed/decrypted\n");
+        else wave = LoadWaveFromResource(chunk);
     }
 
-    return mesh;
+    rresUnloadResourceChunk(chunk);
+
+    return wave;
 }
 
-// Unpack compressed/encrypted data from resource chunk
-// In case data could not be processed by rres.h, it is just copied in chunk.data.raw for processing here
-// NOTE 1: Function return 0 on success or an error code on failure
-// NOTE 2: Data corruption CRC32 check has already been performed by rresLoadResourceMulti() on rres.h
-int UnpackResourceChunk(rresResourceChunk *chunk)
+// Load Mesh data from rres resource, chunks consumed
+// NOTE: Vertex chunks not unpacked successfully are skipped
+Mesh LoadMeshFromResourceConsume(rresResourceMulti multi)
 {
-    int result = 0;
-    bool updateProps = false;
+    RRES_TRACE_BEGIN(convertSpan);
+    for (unsigned int i = 0; i < multi.count; i++) UnpackResourceChunkConsume(&multi.chunks[i]);
 
-    // Result error codes:
-    //  0 - No error, decompression/decryption successful
-    //  1 - Encryption algorithm not supported
-    //  2 - Invalid password on decryption
-    //  3 - Compression algorithm not supported
-    //  4 - Error on data decompression
+    Mesh mesh = LoadMeshFromResourceChunks(multi, true);
+    RRES_TRACE_END(RRES_TRACE_CONVERT, (multi.count > 0)? multi.chunks[0].info.id : 0, (multi.count > 0)? multi.chunks[0].info.type : NULL, convertSpan);
 
-    // NOTE 1: If data is compressed/encrypted the properties are not loaded by rres.h because
-    // it's up to the user to process the data; *chunk must be properly updated by this function
-    // NOTE 2: rres-raylib should support the same algorithms and libraries used by rrespacker tool
-    void *unpackedData = NULL;
+    rresUnloadResourceMulti(multi);
 
-    // STEP 1. Data decryption
-    //-------------------------------------------------------------------------------------
-    unsigned char *decryptedData = NULL;
+    return mesh;
+}
+
+// Load interleaved vertex buffer from rres resource
+VertexBuffer LoadVertexBufferFromResource(rresResourceChunk chunk)
+{
+    VertexBuffer buffer = { 0 };
 
-    switch (chunk->info.cipherType)
+    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
     {
-        case RRES_CIPHER_NONE: decryptedData = (unsigned char *)chunk->data.raw; break;
-#if defined(RRES_SUPPORT_ENCRYPTION_AES)
-        case RRES_CIPHER_AES:
+        RRES_TRACE_BEGIN(convertSpan);
+        if (LoadVertexBufferLayout(chunk, &buffer))
         {
-            // WARNING: Implementation dependant!
-            // rrespacker tool appends (salt[16] + MD5[16]) to encrypted data for convenience,
-            // Actually, chunk->info.packedSize considers those additional elements
+            buffer.data = LoadResourceChunkRaw(&chunk, buffer.vertexCount*buffer.stride, false);
+            if (buffer.data == NULL) memset(&buffer, 0, sizeof(VertexBuffer));
+        }
+        RRES_TRACE_END(RRES_TRACE_CONVERT, chunk.info.id, chunk.info.type, convertSpan);
+    }
+    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
 
-            // Get some memory for the possible message output
-            decryptedData = (unsigned char *)RL_CALLOC(chunk->info.packedSize - 16 - 16, 1);
-            if (decryptedData != NULL) memcpy(decryptedData, chunk->data.raw, chunk->info.packedSize - 16 - 16);
+    return buffer;
+}
 
-            // Required variables for key stretching
-            uint8_t key[32] = { 0 };                    // Encryption key
-            uint8_t salt[16] = { 0 };                   // Key stretching salt
+// Load interleaved vertex buffer from rres resource, chunk consumed
+// NOTE: Vertex buffer data is the chunk raw data, only the layout is loaded from chunk props
+VertexBuffer LoadVertexBufferFromResourceConsume(rresResourceChunk chunk)
+{
+    VertexBuffer buffer = { 0 };
 
-            // Retrieve salt from chunk packed data
-            // salt is stored at the end of packed data, before nonce and MAC: salt[16] + MD5[16]
-            memcpy(salt, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16 - 16), 16);
+    if (UnpackResourceChunkConsume(&chunk))
+    {
+        RRES_TRACE_BEGIN(convertSpan);
+        if (LoadVertexBufferLayout(chunk, &buffer))
+        {
+            buffer.data = LoadResourceChunkRaw(&chunk, buffer.vertexCount*buffer.stride, true);
+            if (buffer.data == NULL) memset(&buffer, 0, sizeof(VertexBuffer));
+        }
+        RRES_TRACE_END(RRES_TRACE_CONVERT, chunk.info.id, chunk.info.type, convertSpan);
+    }
 
-            // Key stretching configuration
-            crypto_argon2_config config = {
-                .algorithm = CRYPTO_ARGON2_I,           // Algorithm: Argon2i
-                .nb_blocks = 16384,                     // Blocks: 16 MB
-                .nb_passes = 3,                         // Iterations
-                .nb_lanes  = 1                          // Single-threaded
-            };
-            crypto_argon2_inputs inputs = {
-                .pass = (const uint8_t *)rresGetCipherPassword(), // User password
-                .salt = salt,                           // Salt for the password
-                .pass_size = (uint32_t)strlen(rresGetCipherPassword()), // Password length
-                .salt_size = 16
-            };
-            crypto_argon2_extras extras = { 0 };        // Extra parameters unused
+    rresUnloadResourceChunk(chunk);
 
-            void *workArea = RL_MALLOC(config.nb_blocks*1024);    // Key stretching work area
+    return buffer;
+}
 
-            // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
-            crypto_argon2(key, 32, workArea, config, inputs, extras);
+// Unload vertex buffer data
+void UnloadVertexBuffer(VertexBuffer buffer)
+{
+    RL_FREE(buffer.data);
+}
 
-            // Wipe key generation secrets, they are no longer needed
-            crypto_wipe(salt, 16);
-            RL_FREE(workArea);
+// Generate mesh resource chunks: interleaved vertex data + indices (if available)
+// NOTE: Mesh arrays available are interleaved in raylib layout order: position, texcoord1, texcoord2, normal, tangent, color
+rresResourceMulti GenMeshResource(Mesh mesh)
+{
+    static const unsigned int attributes[6] = {
+        RRES_VERTEX_ATTRIBUTE_POSITION, RRES_VERTEX_ATTRIBUTE_TEXCOORD1, RRES_VERTEX_ATTRIBUTE_TEXCOORD2,
+        RRES_VERTEX_ATTRIBUTE_NORMAL, RRES_VERTEX_ATTRIBUTE_TANGENT, RRES_VERTEX_ATTRIBUTE_COLOR
+    };
 
-            // Required variables for decryption and message authentication
-            unsigned int md5[4] = { 0 };                // Message Authentication Code generated on encryption
+    rresResourceMulti multi = { 0 };
+    VertexBuffer buffer = { 0 };
+    const unsigned char *arrays[6] = { 0 };
+    unsigned int sizes[6] = { 0 };
 
-            // Retrieve MD5 from chunk packed data
-            // NOTE: MD5 is stored at the end of packed data, after salt: salt[16] + MD5[16]
-            memcpy(md5, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16), 4*sizeof(unsigned int));
+    if ((mesh.vertexCount <= 0) || (mesh.vertices == NULL)) return multi;
 
-            // Message decryption, requires key
-            struct AES_ctx ctx = { 0 };
-            AES_init_ctx(&ctx, key);
-            AES_CTR_xcrypt_buffer(&ctx, (uint8_t *)decryptedData, chunk->info.packedSize - 16 - 16);   // AES Counter mode, stream cipher
+    // Get vertex layout from mesh arrays available
+    for (int i = 0; i < 6; i++)
+    {
+        unsigned int componentCount = 0;
+        unsigned int format = 0;
+        const unsigned char *array = (const unsigned char *)GetMeshAttribute(mesh, attributes[i], &componentCount, &format);
 
-            // Verify MD5 to check if data decryption worked
-            unsigned int decryptMD5[4] = { 0 };
-            unsigned int *md5Ptr = ComputeMD5(decryptedData, chunk->info.packedSize - 16 - 16);
-            for (int i = 0; i < 4; i++) decryptMD5[i] = md5Ptr[i];
+        if (array != NULL)
+        {
+            arrays[buffer.attributeCount] = array;
+            sizes[buffer.attributeCount] = componentCount*GetVertexFormatSize(format);
+            buffer.attributes[buffer.attributeCount].attribute = attributes[i];
+            buffer.attributes[buffer.attributeCount].componentCount = componentCount;
+            buffer.attributes[buffer.attributeCount].format = format;
+            buffer.attributes[buffer.attributeCount].offset = buffer.stride;
+            buffer.stride += sizes[buffer.attributeCount];
+            buffer.attributeCount++;
+        }
+    }
 
-            // Wipe secrets if they are no longer needed
-            crypto_wipe(key, 32);
+    buffer.vertexCount = (unsigned int)mesh.vertexCount;
 
-            if (memcmp(decryptMD5, md5, 4*sizeof(unsigned int)) == 0)    // Decrypted successfully!
-            {
-                chunk->info.packedSize -= (16 + 16);    // We remove additional data size from packed size (salt[16] + MD5[16])
-                RRES_LOG("RRES: %c%c%c%c: Data decrypted successfully (AES)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-            }
-            else
-            {
-                result = 2;    // Data was not decrypted as expected, wrong password or message corrupted
-                RRES_LOG("RRES: WARNING: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-            }
+    if (((unsigned long long)buffer.vertexCount*buffer.stride + (5 + 4*buffer.attributeCount)*sizeof(unsigned int)) > 0xffffffff)
+    {
+        RRES_LOG("RRES: WARNING: VRTX: Mesh vertex data too big to be stored in a resource chunk\n");
+        return multi;
+    }
 
-        } break;
-#endif
-#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
-        case RRES_CIPHER_XCHACHA20_POLY1305:
-        {
-            // WARNING: Implementation dependant!
-            // rrespacker tool appends (salt[16] + nonce[24] + MAC[16]) to encrypted data for convenience,
-            // Actually, chunk->info.packedSize considers those additional elements
+    multi.count = ((mesh.indices != NULL) && (mesh.triangleCount > 0))? 2 : 1;
+    multi.chunks = (rresResourceChunk *)RRES_CALLOC(multi.count, sizeof(rresResourceChunk));
 
-            // Get some memory for the possible message output
-            decryptedData = (unsigned char *)RL_CALLOC(chunk->info.packedSize - 16 - 24 - 16, 1);
+    // Vertex chunk: props[0..3] (vertexCount, attribute, attributeCount, stride) + attributes layout, raw data is the vertex buffer
+    rresResourceChunk *chunk = &multi.chunks[0];
+    memcpy(chunk->info.type, "VRTX", 4);
+    chunk->data.propCount = 4 + 4*buffer.attributeCount;
+    chunk->data.props = (unsigned int *)RRES_CALLOC(chunk->data.propCount, sizeof(unsigned int));
+    chunk->data.props[0] = buffer.vertexCount;
+    chunk->data.props[1] = RRES_VERTEX_ATTRIBUTE_INTERLEAVED;
+    chunk->data.props[2] = buffer.attributeCount;
+    chunk->data.props[3] = buffer.stride;
 
-            // Required variables for key stretching
-            uint8_t key[32] = { 0 };                    // Encryption key
-            uint8_t salt[16] = { 0 };                   // Key stretching salt
+    for (unsigned int i = 0; i < buffer.attributeCount; i++)
+    {
+        chunk->data.props[4 + 4*i] = buffer.attributes[i].attribute;
+        chunk->data.props[5 + 4*i] = buffer.attributes[i].componentCount;
+        chunk->data.props[6 + 4*i] = buffer.attributes[i].format;
+        chunk->data.props[7 + 4*i] = buffer.attributes[i].offset;
+    }
 
-            // Retrieve salt from chunk packed data
-            // salt is stored at the end of packed data, before nonce and MAC: salt[16] + nonce[24] + MAC[16]
-            memcpy(salt, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16 - 24 - 16), 16);
+    chunk->info.baseSize = (1 + chunk->data.propCount)*sizeof(unsigned int) + buffer.vertexCount*buffer.stride;
+    chunk->info.packedSize = chunk->info.baseSize;
 
-            // Key stretching configuration
-            crypto_argon2_config config = {
-                .algorithm = CRYPTO_ARGON2_I,           // Algorithm: Argon2i
-                .nb_blocks = 16384,                     // Blocks: 16 MB
-                .nb_passes = 3,                         // Iterations
-                .nb_lanes  = 1                          // Single-threaded
-            };
-            crypto_argon2_inputs inputs = {
-                .pass = (const uint8_t *)rresGetCipherPassword(), // User password
-                .salt = salt,  // Salt for the password
-                .pass_size = (uint32_t)strlen(rresGetCipherPassword()), // Password length
-                .salt_size = 16
-            };
-            crypto_argon2_extras extras = { 0 };        // Extra parameters unused
+    unsigned char *vertexData = (unsigned char *)RRES_MALLOC((size_t)buffer.vertexCount*buffer.stride);
+    chunk->data.raw = vertexData;
 
-            void *workArea = RL_MALLOC(config.nb_blocks*1024);    // Key stretching work area
+    for (unsigned int v = 0; v < buffer.vertexCount; v++)
+    {
+        for (unsigned int i = 0; i < buffer.attributeCount; i++) memcpy(vertexData + v*buffer.stride + buffer.attributes[i].offset, arrays[i] + v*sizes[i], sizes[i]);
+    }
 
-            // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
-            crypto_argon2(key, 32, workArea, config, inputs, extras);
+    // Index chunk: props[0..3] (indexCount, attribute, componentCount, format), raw data is the index buffer
+    if (multi.count > 1)
+    {
+        unsigned int indexCount = (unsigned int)mesh.triangleCount*3;
+
+        chunk = &multi.chunks[1];
+        memcpy(chunk->info.type, "VRTX", 4);
+        chunk->data.propCount = 4;
+        chunk->data.props = (unsigned int *)RRES_CALLOC(4, sizeof(unsigned int));
+        chunk->data.props[0] = indexCount;
+        chunk->data.props[1] = RRES_VERTEX_ATTRIBUTE_INDEX;
+        chunk->data.props[2] = 1;
+        chunk->data.props[3] = RRES_VERTEX_FORMAT_USHORT;
+        chunk->data.raw = RRES_MALLOC(indexCount*sizeof(unsigned short));
+        memcpy(chunk->data.raw, mesh.indices, indexCount*sizeof(unsigned short));
+        chunk->info.baseSize = 5*sizeof(unsigned int) + indexCount*sizeof(unsigned short);
+        chunk->info.packedSize = chunk->info.baseSize;
+    }
 
-            // Wipe key generation secrets, they are no longer needed
-            crypto_wipe(salt, 16);
-            RL_FREE(workArea);
+    return multi;
+}
 
-            // Required variables for decryption and message authentication
-            uint8_t nonce[24] = { 0 };                  // nonce used on encryption, unique to processed file
-            uint8_t mac[16] = { 0 };                    // Message Authentication Code generated on encryption
+// Quantize vertex chunk data: float components converted to half-float, snorm16 or unorm16
+// NOTE 1: Scale/offset per component are computed from components range: snorm16 [-1..1] and unorm16 [0..1] map the range,
+// half-float values are not normalized (scale = 1.0f, offset = 0.0f), scale/offset are stored in props[4..]
+// NOTE 2: Function returns 0 on success, 1 if chunk is not unpacked float vertex data, 2 if format is not supported
+int QuantizeResourceChunk(rresResourceChunk *chunk, int format)
+{
+    if ((rresGetDataType(chunk->info.type) != RRES_DATA_VERTEX) || (chunk->info.compType != RRES_COMP_NONE) || (chunk->info.cipherType != RRES_CIPHER_NONE) ||
+        (chunk->data.propCount < 4) || (chunk->data.props == NULL) || (chunk->data.raw == NULL) || (chunk->data.props[3] != RRES_VERTEX_FORMAT_FLOAT) ||
+        (chunk->data.props[1] == RRES_VERTEX_ATTRIBUTE_INDEX) || (chunk->data.props[1] == RRES_VERTEX_ATTRIBUTE_INTERLEAVED) ||
+        (chunk->data.props[2] == 0) || (chunk->data.props[2] > 4) ||
+        (((unsigned long long)chunk->data.props[0]*chunk->data.props[2]*sizeof(float) + (1 + chunk->data.propCount)*sizeof(unsigned int)) > chunk->info.baseSize))
+    {
+        RRES_LOG("RRES: WARNING: VRTX: Chunk data can not be quantized, unpacked float vertex data required\n");
+        return 1;
+    }
 
-            // Retrieve nonce and MAC from chunk packed data
-            // nonce and MAC are stored at the end of packed data, after salt: salt[16] + nonce[24] + MAC[16]
-            memcpy(nonce, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16 - 24), 24);
-            memcpy(mac, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16), 16);
+    if ((format != RRES_VERTEX_FORMAT_HFLOAT) && (format != RRES_VERTEX_FORMAT_SHORT) && (format != RRES_VERTEX_FORMAT_USHORT))
+    {
+        RRES_LOG("RRES: WARNING: VRTX: Vertex data quantization format not supported\n");
+        return 2;
+    }
 
-            // Message decryption requires key, nonce and MAC
-            int decryptResult = crypto_aead_unlock(decryptedData, mac, key, nonce, NULL, 0, (unsigned char *)chunk->data.raw, (chunk->info.packedSize - 16 - 24 - 16));
+    unsigned int componentCount = chunk->data.props[2];
+    unsigned int count = chunk->data.props[0]*componentCount;
+    const float *values = (const float *)chunk->data.raw;
+    float scale[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    float offset[4] = { 0 };
 
-            // Wipe secrets if they are no longer needed
-            crypto_wipe(nonce, 24);
-            crypto_wipe(key, 32);
+    // Get components range, mapped to normalized values range
+    if (format != RRES_VERTEX_FORMAT_HFLOAT)
+    {
+        for (unsigned int c = 0; c < componentCount; c++)
+        {
+            float min = (count > 0)? values[c] : 0.0f;
+            float max = min;
 
-            if (decryptResult == 0)    // Decrypted successfully!
+            for (unsigned int i = c; i < count; i += componentCount)
             {
-                chunk->info.packedSize -= (16 + 24 + 16);    // We remove additional data size from packed size
-                RRES_LOG("RRES: %c%c%c%c: Data decrypted successfully (XChaCha20)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+                if (values[i] < min) min = values[i];
+                if (values[i] > max) max = values[i];
             }
-            else if (decryptResult == -1)
-            {
-                result = 2;   // Wrong password or message corrupted
-                RRES_LOG("RRES: WARNING: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-            }
-        } break;
+
+            if (format == RRES_VERTEX_FORMAT_SHORT) { scale[c] = (max - min)*0.5f; offset[c] = min + scale[c]; }
+            else { scale[c] = max - min; offset[c] = min; }
+        }
+    }
+
+    unsigned short *quantized = (unsigned short *)RRES_MALLOC((count > 0)? count*sizeof(unsigned short) : 1);
+    unsigned int *props = (unsigned int *)RRES_CALLOC(4 + 2*componentCount, sizeof(unsigned int));
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        unsigned int c = i%componentCount;
+        float normalized = (scale[c] > 0.0f)? (values[i] - offset[c])/scale[c] : 0.0f;
+
+        if (format == RRES_VERTEX_FORMAT_HFLOAT) quantized[i] = FloatToHalf(values[i]);
+        else if (format == RRES_VERTEX_FORMAT_SHORT)
+        {
+            normalized = (normalized < -1.0f)? -1.0f : (normalized > 1.0f)? 1.0f : normalized;
+            quantized[i] = (unsigned short)(short)((normalized < 0.0f)? (normalized*32767.0f - 0.5f) : (normalized*32767.0f + 0.5f));
+        }
+        else
+        {
+            normalized = (normalized < 0.0f)? 0.0f : (normalized > 1.0f)? 1.0f : normalized;
+            quantized[i] = (unsigned short)(normalized*65535.0f + 0.5f);
+        }
+    }
+
+    // Vertex chunk: props[0..3] (vertexCount, attribute, componentCount, format) + scale[componentCount] + offset[componentCount]
+    memcpy(props, chunk->data.props, 4*sizeof(unsigned int));
+    props[3] = (unsigned int)format;
+    memcpy(props + 4, scale, componentCount*sizeof(float));
+    memcpy(props + 4 + componentCount, offset, componentCount*sizeof(float));
+
+    RRES_FREE(chunk->data.props);
+    RRES_FREE(chunk->data.raw);
+
+    chunk->data.propCount = 4 + 2*componentCount;
+    chunk->data.props = props;
+    chunk->data.raw = quantized;
+    chunk->info.baseSize = (1 + chunk->data.propCount)*sizeof(unsigned int) + count*sizeof(unsigned short);
+    chunk->info.packedSize = chunk->info.baseSize;
+
+    return 0;
+}
+
+// Load vertex indices from rres resource (32-bit values)
+unsigned int *LoadIndicesFromResource(rresResourceChunk chunk, unsigned int *count)
+{
+    unsigned int *indices = NULL;
+    *count = 0;
+
+    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+    {
+        RRES_TRACE_BEGIN(convertSpan);
+        indices = LoadIndicesFromResourceChunk(&chunk, count, false);
+        RRES_TRACE_END(RRES_TRACE_CONVERT, chunk.info.id, chunk.info.type, convertSpan);
+    }
+    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+
+    return indices;
+}
+
+// Load vertex indices from rres resource (32-bit values), chunk consumed
+// NOTE: 32-bit indices are the chunk raw data (no copy), 16-bit indices are converted
+unsigned int *LoadIndicesFromResourceConsume(rresResourceChunk chunk, unsigned int *count)
+{
+    unsigned int *indices = NULL;
+    *count = 0;
+
+    if (UnpackResourceChunkConsume(&chunk))
+    {
+        RRES_TRACE_BEGIN(convertSpan);
+        indices = LoadIndicesFromResourceChunk(&chunk, count, true);
+        RRES_TRACE_END(RRES_TRACE_CONVERT, chunk.info.id, chunk.info.type, convertSpan);
+    }
+
+    rresUnloadResourceChunk(chunk);
+
+    return indices;
+}
+
+// Optimize mesh resource chunks: triangles reordered for vertex cache, vertices for vertex fetch
+// NOTE 1: Mesh chunks must be unpacked: one index chunk (USHORT/UINT) and vertex chunks (attributes or interleaved) with same vertexCount,
+// vertex data is reordered by element (any format), chunks props are not modified
+// NOTE 2: Function returns 0 on success, 1 if mesh chunks are not valid, 2 if indices are not valid (triangles list)
+int OptimizeMeshResource(rresResourceMulti *multi)
+{
+    rresResourceChunk *indexChunk = NULL;
+    unsigned int vertexCount = 0;
+    bool valid = (multi->count > 1);
+
+    // Validate mesh chunks before data is modified: all vertex chunks must be reordered
+    for (unsigned int i = 0; valid && (i < multi->count); i++)
+    {
+        rresResourceChunk *chunk = &multi->chunks[i];
+
+        valid = (rresGetDataType(chunk->info.type) == RRES_DATA_VERTEX) && (chunk->info.compType == RRES_COMP_NONE) &&
+            (chunk->info.cipherType == RRES_CIPHER_NONE) && (chunk->data.propCount >= 4) && (chunk->data.props != NULL) && (chunk->data.raw != NULL);
+        if (!valid) break;
+
+        unsigned long long dataSize = 0;
+
+        if (chunk->data.props[1] == RRES_VERTEX_ATTRIBUTE_INDEX)
+        {
+            valid = (indexChunk == NULL) && (chunk->data.props[2] == 1) &&
+                ((chunk->data.props[3] == RRES_VERTEX_FORMAT_USHORT) || (chunk->data.props[3] == RRES_VERTEX_FORMAT_UINT));
+            dataSize = (unsigned long long)chunk->data.props[0]*GetVertexFormatSize(chunk->data.props[3]);
+            indexChunk = chunk;
+        }
+        else
+        {
+            VertexBuffer buffer = { 0 };
+
+            if (vertexCount == 0) vertexCount = chunk->data.props[0];
+
+            if (chunk->data.props[1] == RRES_VERTEX_ATTRIBUTE_INTERLEAVED) valid = LoadVertexBufferLayout(*chunk, &buffer);
+            else buffer.stride = chunk->data.props[2]*GetVertexFormatSize(chunk->data.props[3]);
+
+            valid = valid && (chunk->data.props[0] == vertexCount) && (buffer.stride > 0);
+            dataSize = (unsigned long long)vertexCount*buffer.stride;
+        }
+
+        valid = valid && ((dataSize + (1 + chunk->data.propCount)*sizeof(unsigned int)) <= chunk->info.baseSize);
+    }
+
+    if (!valid || (indexChunk == NULL) || (vertexCount == 0))
+    {
+        RRES_LOG("RRES: WARNING: MESH: Mesh chunks can not be optimized, unpacked index and vertex chunks required\n");
+        return 1;
+    }
+
+    unsigned int indexCount = 0;
+    unsigned int *indices = LoadIndicesFromResourceChunk(indexChunk, &indexCount, false);
+
+    valid = (indices != NULL) && ((indexCount%3) == 0);
+    for (unsigned int i = 0; valid && (i < indexCount); i++) if (indices[i] >= vertexCount) valid = false;
+
+    if (!valid || !OptimizeVertexCache(indices, indexCount, vertexCount))
+    {
+        RRES_LOG("RRES: WARNING: MESH: Mesh indices can not be optimized, triangles list indices not valid\n");
+        RL_FREE(indices);
+        return 2;
+    }
+
+    // Vertices remapped by first use in reordered triangles, vertices not used are moved to the end
+    unsigned int *remap = (unsigned int *)RL_MALLOC((size_t)vertexCount*sizeof(unsigned int));
+    unsigned int next = 0;
+
+    memset(remap, 0xff, (size_t)vertexCount*sizeof(unsigned int));
+
+    for (unsigned int i = 0; i < indexCount; i++)
+    {
+        if (remap[indices[i]] == 0xffffffff) remap[indices[i]] = next++;
+        indices[i] = remap[indices[i]];
+    }
+
+    for (unsigned int v = 0; v < vertexCount; v++) if (remap[v] == 0xffffffff) remap[v] = next++;
+
+    // Indices stored with chunk index format
+    unsigned int indexSize = GetVertexFormatSize(indexChunk->data.props[3]);
+    for (unsigned int i = 0; i < indexCount; i++) memcpy((unsigned char *)indexChunk->data.raw + (size_t)i*indexSize, &indices[i], indexSize);
+
+    // Vertex data reordered, every vertex element (attribute components or interleaved vertex) moved to its new position
+    for (unsigned int i = 0; i < multi->count; i++)
+    {
+        rresResourceChunk *chunk = &multi->chunks[i];
+
+        if (chunk == indexChunk) continue;
+
+        unsigned int elementSize = (chunk->data.props[1] == RRES_VERTEX_ATTRIBUTE_INTERLEAVED)? chunk->data.props[3] : chunk->data.props[2]*GetVertexFormatSize(chunk->data.props[3]);
+        unsigned char *data = (unsigned char *)RRES_MALLOC((size_t)vertexCount*elementSize);
+
+        for (unsigned int v = 0; v < vertexCount; v++) memcpy(data + (size_t)remap[v]*elementSize, (unsigned char *)chunk->data.raw + (size_t)v*elementSize, elementSize);
+
+        // NOTE: Raw data not part of vertex elements (if any) is not kept
+        RRES_FREE(chunk->data.raw);
+        chunk->data.raw = data;
+        chunk->info.baseSize = (1 + chunk->data.propCount)*sizeof(unsigned int) + vertexCount*elementSize;
+        chunk->info.packedSize = chunk->info.baseSize;
+    }
+
+    RL_FREE(remap);
+    RL_FREE(indices);
+
+    return 0;
+}
+
+// Unpack compressed/encrypted data from resource chunk
+// In case data could not be processed by rres.h, it is just copied in chunk.data.raw for processing here
+// NOTE 1: Function return 0 on success or an error code on failure
+// NOTE 2: Data corruption CRC32 check has already been performed by rresLoadResourceMulti() on rres.h
+// NOTE 3: Data is decrypted in place and decompressed directly into the final buffer (sized from chunk->info.baseSize),
+// chunk->data.raw points to that buffer start, only chunk->data.props[] are copied into a separate (small) allocation
+int UnpackResourceChunk(rresResourceChunk *chunk)
+{
+    int result = 0;
+    bool updateProps = false;
+
+    // Result error codes:
+    //  0 - No error, decompression/decryption successful
+    //  1 - Encryption algorithm not supported
+    //  2 - Invalid password on decryption
+    //  3 - Compression algorithm not supported
+    //  4 - Error on data decompression
+    //  5 - Chunk data properties not valid
+    //  6 - Memory allocation failed (properties)
+
+    // NOTE 1: If data is compressed/encrypted the properties are not loaded by rres.h because
+    // it's up to the user to process the data; *chunk must be properly updated by this function
+    // NOTE 2: rres-raylib should support the same algorithms and libraries used by rrespacker tool
+    unsigned char *unpackedData = NULL;
+#if defined(RRES_SUPPORT_STATS)
+    unsigned int packedSize = chunk->info.packedSize;   // Packed data size, required to record memory released
 #endif
-        default:
+
+    // STEP 1. Data decryption, in place
+    //-------------------------------------------------------------------------------------
+    // NOTE: Decrypted data size is always smaller than packed data (cipher additional data is removed),
+    // so chunk->data.raw is directly reused, no memory allocation or copy required
+    unsigned char *decryptedData = (unsigned char *)chunk->data.raw;
+
+    if (chunk->info.cipherType != RRES_CIPHER_NONE)
+    {
+        const EncryptionCipher *cipher = GetEncryptionCipher(chunk->info.cipherType);
+
+        if ((cipher != NULL) && (cipher->decrypt != NULL))
+        {
+            unsigned int decryptedSize = 0;
+
+            RRES_TRACE_BEGIN(decryptSpan);
+            bool decrypted = cipher->decrypt(decryptedData, chunk->info.packedSize, &decryptedSize);
+            RRES_TRACE_END(RRES_TRACE_DECRYPT, chunk->info.id, chunk->info.type, decryptSpan);
+
+            if (decrypted)
+            {
+                // Data is not encrypted any more, register it
+                chunk->info.packedSize = decryptedSize;     // We remove additional data size from packed size
+                chunk->info.cipherType = RRES_CIPHER_NONE;
+                updateProps = true;
+                RRES_LOG("RRES: %c%c%c%c: Data decrypted successfully (%s)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3], cipher->name);
+            }
+            else
+            {
+                result = 2;   // Wrong password or message corrupted
+                RRES_LOG("RRES: WARNING: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+            }
+        }
+        else
         {
             result = 1;    // Decryption algorithm not supported
             RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data encryption algorithm not supported\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        }
+    }
+
+    // STEP 2: Data decompression (if decryption was successful), into final buffer
+    //-------------------------------------------------------------------------------------
+    if ((result == 0) && (chunk->info.compType != RRES_COMP_NONE))
+    {
+        const CompressionCodec *codec = GetCompressionCodec(chunk->info.compType);
+        const CompressionDictionary *dictionary = NULL;
+        unsigned int compDataSize = chunk->info.packedSize;
+        bool compBlocks = ((chunk->info.flags & RRES_FLAG_COMP_BLOCKS) != 0);
+        bool compDict = ((chunk->info.flags & RRES_FLAG_COMP_DICTIONARY) != 0);
+
+        // Check codec supports chunk data layout: blocks or dictionary require decompression into provided buffer
+        if ((codec == NULL) || (compBlocks && compDict) || (compBlocks && !codec->blocks) || (compDict && !codec->dictionary) ||
+            ((codec->decompressInto == NULL) && ((codec->decompress == NULL) || compDict)))
+        {
+            result = 3;
+            RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data compression algorithm not supported\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        }
+        else if (!IsDataFilterValid(chunk->info.flags))
+        {
+            result = 3;
+            RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data filter not supported: 0x%04x\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3], chunk->info.flags);
+        }
+        else if (compDict)
+        {
+            // Data compressed with a dictionary, dictionary id is stored after compressed data
+            unsigned int dictionaryId = 0;
+
+            if (compDataSize > sizeof(unsigned int))
+            {
+                compDataSize -= sizeof(unsigned int);
+                memcpy(&dictionaryId, decryptedData + compDataSize, sizeof(unsigned int));
+            }
+
+            dictionary = GetCompressionDictionary(dictionaryId);
+
+            if (dictionary == NULL)
+            {
+                result = 3;
+                RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data compression dictionary not loaded: 0x%08x\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3], dictionaryId);
+            }
+        }
+
+        if (result == 0)
+        {
+            bool decompressed = false;
+
+            RRES_STATS_BEGIN(decompTimer);
+            RRES_TRACE_BEGIN(decompSpan);
+            if (compBlocks || (codec->decompressInto != NULL))
+            {
+                // NOTE: No need to clear memory, all data is written by decompressor on success
+                unpackedData = (unsigned char *)RRES_MALLOC(chunk->info.baseSize);
+
+                if (unpackedData != NULL)
+                {
+                    // Data compressed in independent blocks is decompressed in parallel (if possible)
+                    if (compBlocks) decompressed = DecompressDataBlocks(decryptedData, compDataSize, codec, unpackedData, chunk->info.baseSize);
+                    else decompressed = codec->decompressInto(decryptedData, compDataSize, (dictionary != NULL)? dictionary->data : NULL,
+                        (dictionary != NULL)? dictionary->size : 0, unpackedData, chunk->info.baseSize);
+                }
+            }
+            else
+            {
+                unsigned int uncompDataSize = 0;
+                unpackedData = codec->decompress(decryptedData, compDataSize, &uncompDataSize);
+
+                // Security check, uncompDataSize must match the provided chunk->baseSize
+                decompressed = (unpackedData != NULL) && (uncompDataSize == chunk->info.baseSize);
+            }
+            RRES_TRACE_END(RRES_TRACE_DECOMPRESS, chunk->info.id, chunk->info.type, decompSpan);
+            RRES_STATS_END(RRES_STATS_EVENT_DECOMPRESS, chunk->info.compType, decompTimer);
+
+            if (decompressed)
+            {
+                // Data is not compressed any more, register it
+                chunk->info.packedSize = chunk->info.baseSize;
+                chunk->info.compType = RRES_COMP_NONE;
+                chunk->info.flags &= ~(RRES_FLAG_COMP_BLOCKS | RRES_FLAG_COMP_DICTIONARY);
+                updateProps = true;
+                RRES_LOG("RRES: %c%c%c%c: Data decompressed successfully (%s%s)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3], codec->name, compBlocks? ", blocks" : "");
+            }
+            else
+            {
+                RRES_FREE(unpackedData);
+                unpackedData = NULL;
+                result = 4;    // Decompression process failed
+                RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data decompression failed\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+            }
+        }
+    }
+    else if (result == 0) unpackedData = decryptedData;
+
+    // STEP 3: Data properties extraction (if decompression was successful)
+    //-------------------------------------------------------------------------------------
+    if ((result == 0) && updateProps)
+    {
+        if (chunk->data.props == NULL)
+        {
+            // Unpacked data contains everything: propCount + props[] + data
+            // NOTE: Only props[] are copied, data is moved in place to the start of the buffer,
+            // chunk->data.raw must point to the allocated memory start to be freed (or owned by user)
+            // NOTE: Props size computed in 64 bit, propCount read from data could overflow it
+            unsigned int propCount = 0;
+            unsigned long long propsSize = 0;
+
+            if (chunk->info.baseSize >= sizeof(unsigned int))
+            {
+                memcpy(&propCount, unpackedData, sizeof(unsigned int));
+                propsSize = (1 + (unsigned long long)propCount)*sizeof(unsigned int);
+            }
+
+            // NOTE: On failure chunk is returned without props (propCount = 0), data is not moved
+            chunk->data.propCount = 0;
+
+            if ((chunk->info.baseSize >= sizeof(unsigned int)) && (propsSize <= chunk->info.baseSize))
+            {
+                if (propCount > 0)
+                {
+                    chunk->data.props = (unsigned int *)RRES_CALLOC(propCount, sizeof(unsigned int));
+
+                    if (chunk->data.props != NULL)
+                    {
+                        memcpy(chunk->data.props, unpackedData + sizeof(unsigned int), propCount*sizeof(unsigned int));
+                        chunk->data.propCount = propCount;
+                    }
+                    else
+                    {
+                        result = 6;
+                        RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data properties memory could not be allocated\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+                    }
+                }
+
+                if (result == 0)
+                {
+                    // Filtered data (if required) is restored while moved, filters undone by tiles
+                    if ((chunk->info.flags & FILTER_FLAGS) != 0)
+                    {
+                        UnfilterData(unpackedData, unpackedData + propsSize, chunk->info.baseSize - propsSize, chunk->info.flags);
+                        chunk->info.flags &= ~FILTER_FLAGS;
+                    }
+                    else memmove(unpackedData, unpackedData + propsSize, chunk->info.baseSize - propsSize);
+                }
+            }
+            else
+            {
+                result = 5;
+                RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data properties not valid\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+            }
+        }
+
+        // Packed data is replaced by unpacked data (if not already unpacked in place)
+        // NOTE: Data unpacked in place is not a new allocation, only memory accounted is updated to unpacked size
+        if (unpackedData != (unsigned char *)chunk->data.raw)
+        {
+            RRES_FREE(chunk->data.raw);
+            chunk->data.raw = unpackedData;
+
+            RRES_STATS_RECORD(RRES_STATS_EVENT_ALLOC, 0, chunk->info.baseSize - sizeof(int));  // props[] + data
+            RRES_STATS_RECORD(RRES_STATS_EVENT_FREE, 0, packedSize);
+        }
+#if defined(RRES_SUPPORT_STATS)
+        else if (packedSize > (chunk->info.baseSize - sizeof(int))) RRES_STATS_RECORD(RRES_STATS_EVENT_FREE, 0, packedSize - (chunk->info.baseSize - sizeof(int)));
+#endif
+    }
+
+    return result;
+}
+
+// Pack resource chunk data: compress and encrypt (in that order)
+// NOTE 1: Data is packed the same way rrespacker tool does, algorithms additional data is appended to packed data:
+//  - RRES_COMP_QOI: Only image pixels are compressed, props are reconstructed from QOI header on unpacking
+//  - RRES_COMP_QOI (stripes): "qois" + width + height + channels + stripeRows + stripeCount + offsets[stripeCount + 1] + QOI stripes
+//  - RRES_COMP_INDEX_DELTA: propCount + props[] (not compressed) + indices delta with previous index (zigzag varint), only VRTX index data
+//  - RRES_FLAG_COMP_BLOCKS: blockSize + blockCount + offsets[blockCount + 1] + blocks data (DEFLATE, LZ4)
+//  - RRES_FLAG_COMP_DICTIONARY: dictionaryId (LZ4)
+//  - RRES_CIPHER_AES: salt[16] + MD5[16]
+//  - RRES_CIPHER_XCHACHA20_POLY1305: salt[16] + nonce[24] + MAC[16]
+//  - RRES_CIPHER_XCHACHA20_POLY1305_SEGMENTED: MAC[16]*segmentCount + salt[16] + nonce[24] + segmentSize + dataSize
+// NOTE 2: Function return 0 on success or an error code on failure
+int PackResourceChunk(rresResourceChunk *chunk, int compType, int cipherType)
+{
+    int result = 0;
+
+    // Result error codes:
+    //  0 - No error, compression/encryption successful
+    //  1 - Encryption algorithm not supported
+    //  3 - Compression algorithm not supported
+    //  4 - Error on data compression (or data not supported by compression algorithm)
+    //  5 - Chunk data is already packed
+    //  6 - Data filter not valid
+    //  7 - Chunk data size not valid (or memory allocation failed)
+
+    if ((chunk->info.compType != RRES_COMP_NONE) || (chunk->info.cipherType != RRES_CIPHER_NONE) || (chunk->data.raw == NULL)) return 5;
+
+    // NOTE: Data filters are only applied to compressed data
+    if (compType == RRES_COMP_NONE) chunk->info.flags &= ~FILTER_FLAGS;
+    else if (!IsDataFilterValid(chunk->info.flags))
+    {
+        RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data filter not valid: 0x%04x\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3], chunk->info.flags);
+        return 6;
+    }
+
+    // Get unpacked data as stored in rres file: propCount + props[] + raw, data filters (if requested) applied
+    unsigned char *unpackedData = LoadPackingData(chunk);
+    if (unpackedData == NULL) return 7;
+
+    // STEP 1. Data compression
+    //-------------------------------------------------------------------------------------
+    unsigned char *compData = NULL;
+    unsigned int compDataSize = 0;
+    const CompressionCodec *codec = (compType != RRES_COMP_NONE)? GetCompressionCodec(compType) : NULL;
+    // NOTE: Compression dictionary is used for chunks fitting in one block, larger chunks are compressed in blocks (if requested)
+    bool compDict = (codec != NULL) && codec->dictionary && (compDictionary >= 0) && ((compBlockSize == 0) || (chunk->info.baseSize <= compBlockSize));
+    bool compBlocks = !compDict && (codec != NULL) && codec->blocks && (compBlockSize > 0);
+
+    if (compType == RRES_COMP_NONE)
+    {
+        compData = unpackedData;
+        compDataSize = chunk->info.baseSize;
+    }
+    else if ((codec == NULL) || (codec->compress == NULL)) result = 3;
+    else if (compBlocks) compData = CompressDataBlocks(unpackedData, chunk->info.baseSize, codec, compBlockSize, &compDataSize);
+    else if (compDict)
+    {
+        // Data compressed with dictionary, dictionary id appended to compressed data
+        const CompressionDictionary *dictionary = &compDictionaries[compDictionary];
+        compData = codec->compress(unpackedData, chunk->info.baseSize, dictionary->data, dictionary->size, &compDataSize);
+
+        unsigned char *dictData = (compData != NULL)? (unsigned char *)RL_REALLOC(compData, compDataSize + sizeof(unsigned int)) : NULL;
+
+        if (dictData != NULL)
+        {
+            compData = dictData;
+            memcpy(compData + compDataSize, &dictionary->id, sizeof(unsigned int));
+            compDataSize += sizeof(unsigned int);
+        }
+        else compDataSize = 0;
+    }
+    else compData = codec->compress(unpackedData, chunk->info.baseSize, NULL, 0, &compDataSize);
+
+    if ((result == 0) && ((compData == NULL) || (compDataSize == 0))) result = 4;
+    if (compData != unpackedData) RL_FREE(unpackedData);
+
+    if (result != 0)
+    {
+        RL_FREE(compData);
+        RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data compression failed\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        return result;
+    }
+
+    // STEP 2. Data encryption
+    //-------------------------------------------------------------------------------------
+    unsigned char *packedData = NULL;
+    unsigned int packedSize = 0;
+
+    if (cipherType == RRES_CIPHER_NONE)
+    {
+        packedData = compData;
+        packedSize = compDataSize;
+    }
+    else
+    {
+        const EncryptionCipher *cipher = GetEncryptionCipher(cipherType);
+
+        if ((cipher != NULL) && (cipher->encrypt != NULL)) packedData = cipher->encrypt(compData, compDataSize, &packedSize);
+
+        if (packedData == NULL)
+        {
+            result = 1;    // Encryption algorithm not supported (or encryption failed)
+            RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data encryption algorithm not supported or encryption failed\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        }
+    }
+
+    if (packedData != compData) RL_FREE(compData);
+
+    if (result == 0)
+    {
+        chunk->info.compType = (unsigned char)compType;
+        chunk->info.cipherType = (unsigned char)cipherType;
+        if (compBlocks) chunk->info.flags |= RRES_FLAG_COMP_BLOCKS;
+        if (compDict) chunk->info.flags |= RRES_FLAG_COMP_DICTIONARY;
+        chunk->info.packedSize = packedSize;
+        chunk->info.crc32 = rresComputeCRC32(packedData, packedSize);
+
+        if ((compType == RRES_COMP_NONE) && (cipherType == RRES_CIPHER_NONE))
+        {
+            // Data not compressed/encrypted is kept unpacked (props[] + raw), as loaded by rres.h
+            RL_FREE(packedData);
+        }
+        else
+        {
+            // Packed data is stored in chunk->data.raw, with no props
+            RRES_FREE(chunk->data.props);
+            RRES_FREE(chunk->data.raw);
+
+            chunk->data.propCount = 0;
+            chunk->data.props = NULL;
+            chunk->data.raw = packedData;
+        }
+    }
+
+    return result;
+}
+
+// Load raw data range from resource chunk in file
+// NOTE: Raw data offset requires props count, first unpacked data word (propCount) is read in advance
+void *LoadResourceDataRange(const char *fileName, unsigned int rresId, unsigned int offset, unsigned int size, unsigned int *dataSize)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+    rresResourceChunkInfo info = rresLoadResourceChunkInfo(fileName, rresId);
+
+    if ((info.id != rresId) || (info.packedSize == 0)) return NULL;
+
+    const CompressionCodec *codec = GetCompressionCodec(info.compType);
+    const EncryptionCipher *cipher = GetEncryptionCipher(info.cipherType);
+
+    if (((info.compType == RRES_COMP_NONE) || (((info.flags & RRES_FLAG_COMP_BLOCKS) != 0) && (codec != NULL) && codec->blocks)) && ((info.flags & FILTER_FLAGS) == 0) &&
+        ((info.cipherType == RRES_CIPHER_NONE) || ((cipher != NULL) && (cipher->decryptRange != NULL))))
+    {
+        // Unpacked data: propCount + props[] + raw, only required range is read (decrypted and decompressed)
+        unsigned int propCount = 0;
+
+        if (LoadUnpackedDataRange(fileName, info, 0, sizeof(unsigned int), (unsigned char *)&propCount) && (propCount < info.baseSize/sizeof(unsigned int)))
+        {
+            unsigned int propsSize = (1 + propCount)*sizeof(unsigned int);
+            unsigned int rawSize = info.baseSize - propsSize;
+
+            if ((offset < rawSize) && (size > 0))
+            {
+                if (size > (rawSize - offset)) size = rawSize - offset;
+
+                data = (unsigned char *)RL_MALLOC(size);
+
+                if ((data != NULL) && LoadUnpackedDataRange(fileName, info, propsSize + offset, size, data)) *dataSize = size;
+                else
+                {
+                    RL_FREE(data);
+                    data = NULL;
+                }
+            }
+        }
+    }
+    else
+    {
+        // Packed data range can not be unpacked independently, full chunk is loaded and unpacked
+        rresResourceChunk chunk = rresLoadResourceChunk(fileName, rresId);
+        if ((chunk.info.flags & RRES_FLAG_COMP_DICTIONARY) != 0) LoadCompressionDictionaries(fileName);
+
+        if ((chunk.data.raw != NULL) && (UnpackResourceChunk(&chunk) == 0))
+        {
+            unsigned int rawSize = chunk.info.baseSize - (1 + chunk.data.propCount)*sizeof(unsigned int);
+
+            if ((offset < rawSize) && (size > 0))
+            {
+                if (size > (rawSize - offset)) size = rawSize - offset;
+
+                data = (unsigned char *)RL_MALLOC(size);
+
+                if (data != NULL)
+                {
+                    memcpy(data, (unsigned char *)chunk.data.raw + offset, size);
+                    *dataSize = size;
+                }
+            }
+        }
+
+        rresUnloadResourceChunk(chunk);
+    }
+
+    if (data == NULL) RRES_LOG("RRES: WARNING: Resource data range could not be loaded: 0x%08x [%u, %u]\n", rresId, offset, size);
+
+    return data;
+}
+
+// Load resource chunk from cache, loaded and unpacked from file if not cached
+// NOTE: Returns NULL if resource chunk could not be loaded or unpacked
+const rresResourceChunk *LoadResourceChunkCached(const char *fileName, unsigned int rresId)
+{
+    unsigned int fileId = rresComputeCRC32((const unsigned char *)fileName, (int)strlen(fileName));
+    ResourceCacheEntry **bucket = &cache.buckets[RESOURCE_CACHE_HASH(fileId, rresId)];
+
+    // Look for the requested chunk in cache
+    for (ResourceCacheEntry *entry = *bucket; entry != NULL; entry = entry->nextHash)
+    {
+        if ((entry->fileId == fileId) && (entry->rresId == rresId) && (strcmp(entry->fileName, fileName) == 0))
+        {
+            if (entry->refCount == 0) UnlinkResourceCacheUnused(entry);
+            entry->refCount++;
+            cache.stats.hits++;
+
+            return &entry->chunk;
+        }
+    }
+
+    cache.stats.misses++;
+
+    // Chunk not cached, load and unpack it from file
+    rresResourceChunk chunk = rresLoadResourceChunk(fileName, rresId);
+
+    if (chunk.data.raw == NULL) return NULL;
+    if ((chunk.info.flags & RRES_FLAG_COMP_DICTIONARY) != 0) LoadCompressionDictionaries(fileName);
+    if (UnpackResourceChunk(&chunk) != 0)
+    {
+        rresUnloadResourceChunk(chunk);
+        return NULL;
+    }
+
+    ResourceCacheEntry *entry = (ResourceCacheEntry *)RRES_CALLOC(1, sizeof(ResourceCacheEntry));
+    if (entry != NULL) entry->fileName = CopyFileName(fileName);
+
+    if ((entry == NULL) || (entry->fileName == NULL))
+    {
+        RRES_FREE(entry);
+        rresUnloadResourceChunk(chunk);
+        return NULL;
+    }
+
+    entry->fileId = fileId;
+    entry->rresId = rresId;
+    entry->chunk = chunk;
+    entry->size = chunk.info.baseSize;    // Unpacked data size: propCount + props[] + data
+    entry->refCount = 1;
+    entry->nextHash = *bucket;
+    *bucket = entry;
+    entry->nextChunk = cache.chunkBuckets[RESOURCE_CACHE_CHUNK_HASH(&entry->chunk)];
+    cache.chunkBuckets[RESOURCE_CACHE_CHUNK_HASH(&entry->chunk)] = entry;
+
+    cache.stats.count++;
+    cache.stats.usedBytes += entry->size;
+
+    // Make room for the new chunk, evicting unreferenced chunks if required
+    EvictResourceCache(cacheBudget);
+
+    return &entry->chunk;
+}
+
+// Release cached resource chunk reference
+// NOTE: Chunk is kept in cache for later requests, it's only evicted if cache exceeds memory budget
+void UnloadResourceChunkCached(const rresResourceChunk *chunk)
+{
+    // NOTE: Chunk is not accessed until found in cache, it could be already evicted
+    for (ResourceCacheEntry *entry = cache.chunkBuckets[RESOURCE_CACHE_CHUNK_HASH(chunk)]; entry != NULL; entry = entry->nextChunk)
+    {
+        if (&entry->chunk == chunk)
+        {
+            if (entry->refCount > 0)
+            {
+                entry->refCount--;
+                if (entry->refCount == 0) LinkResourceCacheUnused(entry);
+            }
+            break;
+        }
+    }
+
+    EvictResourceCache(cacheBudget);
+}
+
+// Set resource cache memory budget (bytes)
+void SetResourceCacheBudget(unsigned int budget)
+{
+    cacheBudget = budget;
+
+    EvictResourceCache(budget);
+}
+
+// Unload all unreferenced cached resource chunks
+// NOTE: Chunks still referenced are kept in cache
+void ClearResourceCache(void)
+{
+    EvictResourceCache(0);
+}
+
+// Get resource cache stats
+ResourceCacheStats GetResourceCacheStats(void)
+{
+    ResourceCacheStats stats = cache.stats;
+    stats.budgetBytes = cacheBudget;
+
+    return stats;
+}
+
+// Set salt[16] shared by all packed chunks (NULL for random salt per chunk)
+// NOTE: Provided salt is copied, only used by RRES_CIPHER_XCHACHA20_POLY1305
+void SetCipherSalt(const unsigned char *salt)
+{
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+    if (salt != NULL) memcpy(cipherSalt, salt, 16);
+    else crypto_wipe(cipherSalt, 16);
+
+    cipherSaltShared = (salt != NULL);
+#else
+    (void)salt;                         // Encryption not supported
+#endif
+}
+
+// Clear cipher keys cache, cached keys are wiped
+void ClearCipherKeyCache(void)
+{
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+    crypto_wipe(cipherKeys, sizeof(cipherKeys));
+    cipherKeysTick = 0;
+#endif
+}
+
+// Set block size for data compression in independent blocks (0: one stream)
+void SetCompressionBlockSize(unsigned int size)
+{
+    compBlockSize = size;
+}
+
+// Get data filter flags recommended for chunk data
+// NOTE: Filters are recommended for multi-byte elements: float/16-bit image pixels, audio samples and vertex data,
+// float data is XOR filtered, integer data is delta encoded, previous element is the same channel/component
+unsigned int GetCompressionFilter(const rresResourceChunk *chunk)
+{
+    unsigned int flags = 0;
+    unsigned int elementSize = 0;       // Element size (bytes), 0 if no filter recommended
+    unsigned int distance = 1;          // Previous element distance: channels/components per element
+    bool floatData = false;
+
+    if ((chunk->data.propCount < 4) || (chunk->data.props == NULL)) return 0;
+
+    switch (rresGetDataType(chunk->info.type))
+    {
+        case RRES_DATA_IMAGE:
+        {
+            floatData = true;
+
+            if (chunk->data.props[2] == RRES_PIXELFORMAT_UNCOMP_R32) elementSize = 4;
+            else if (chunk->data.props[2] == RRES_PIXELFORMAT_UNCOMP_R32G32B32) { elementSize = 4; distance = 3; }
+            else if (chunk->data.props[2] == RRES_PIXELFORMAT_UNCOMP_R32G32B32A32) { elementSize = 4; distance = 4; }
+        } break;
+        case RRES_DATA_WAVE:
+        {
+            // NOTE: 32 bit samples are float data
+            if ((chunk->data.props[2] == 8) || (chunk->data.props[2] == 16) || (chunk->data.props[2] == 32)) elementSize = chunk->data.props[2]/8;
+            floatData = (elementSize == 4);
+            distance = chunk->data.props[3];
+        } break;
+        case RRES_DATA_VERTEX:
+        {
+            // Interleaved vertex data: every 4-byte word XOR with the same word of previous vertex (max 16 words per vertex)
+            if (chunk->data.props[1] == RRES_VERTEX_ATTRIBUTE_INTERLEAVED)
+            {
+                if (((chunk->data.props[3]%4) == 0) && (chunk->data.props[3] >= 4) && (chunk->data.props[3] <= 64))
+                {
+                    elementSize = 4;
+                    floatData = true;
+                    distance = chunk->data.props[3]/4;
+                }
+                break;
+            }
+
+            switch (chunk->data.props[3])
+            {
+                case RRES_VERTEX_FORMAT_UBYTE:
+                case RRES_VERTEX_FORMAT_BYTE: elementSize = 1; break;
+                case RRES_VERTEX_FORMAT_USHORT:
+                case RRES_VERTEX_FORMAT_SHORT: elementSize = 2; break;
+                case RRES_VERTEX_FORMAT_UINT:
+                case RRES_VERTEX_FORMAT_INT: elementSize = 4; break;
+                case RRES_VERTEX_FORMAT_HFLOAT: elementSize = 2; floatData = true; break;
+                case RRES_VERTEX_FORMAT_FLOAT: elementSize = 4; floatData = true; break;
+                default: break;
+            }
+
+            distance = chunk->data.props[2];
+        } break;
+        default: break;
+    }
+
+    if (elementSize > 0)
+    {
+        if ((distance < 1) || (distance > 16)) distance = 1;
+
+        flags = floatData? RRES_FLAG_FILTER_XOR : RRES_FLAG_FILTER_DELTA;
+        if (elementSize == 2) flags |= (RRES_FLAG_FILTER_SHUFFLE | RRES_FLAG_FILTER_ELEMENT_2);
+        else if (elementSize == 4) flags |= (RRES_FLAG_FILTER_SHUFFLE | RRES_FLAG_FILTER_ELEMENT_4);
+        flags |= (distance - 1)*RRES_FLAG_FILTER_DISTANCE;
+    }
+
+    return flags;
+}
+
+// Generate compression dictionary chunk, trained on unpacked chunks data
+// NOTE: Chunks data is split in segments, segments containing the 8-byte sequences found in more chunks
+// are copied into the dictionary, the most relevant ones at the end (closer to compressed data)
+rresResourceChunk GenCompressionDictionary(const rresResourceChunk *chunks, int count, unsigned int size)
+{
+    rresResourceChunk dictionary = { 0 };
+
+    if (size > COMP_DICTIONARY_MAX_SIZE) size = COMP_DICTIONARY_MAX_SIZE;
+
+    // Get training samples: unpacked chunks data as compressed by PackResourceChunk(), propCount + props[] + raw
+    unsigned long long samplesSize = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if ((chunks[i].info.compType == RRES_COMP_NONE) && (chunks[i].info.cipherType == RRES_CIPHER_NONE) && (chunks[i].data.raw != NULL)) samplesSize += chunks[i].info.baseSize;
+    }
+
+    if ((size == 0) || (samplesSize == 0) || (samplesSize > 0xffffffff)) return dictionary;
+
+    unsigned char *samples = (unsigned char *)RL_MALLOC((size_t)samplesSize);
+    unsigned int *sampleOffsets = (unsigned int *)RL_CALLOC(count + 1, sizeof(unsigned int));
+    unsigned int *counts = (unsigned int *)RL_CALLOC(COMP_DICTIONARY_HASH_SIZE, sizeof(unsigned int));
+    unsigned int *lastSample = (unsigned int *)RL_CALLOC(COMP_DICTIONARY_HASH_SIZE, sizeof(unsigned int));
+    unsigned int sampleCount = 0;
+    unsigned int offset = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if ((chunks[i].info.compType != RRES_COMP_NONE) || (chunks[i].info.cipherType != RRES_CIPHER_NONE) || (chunks[i].data.raw == NULL)) continue;
+
+        unsigned int propsSize = (1 + chunks[i].data.propCount)*sizeof(unsigned int);
+        memcpy(samples + offset, &chunks[i].data.propCount, sizeof(unsigned int));
+        if (chunks[i].data.propCount > 0) memcpy(samples + offset + sizeof(unsigned int), chunks[i].data.props, chunks[i].data.propCount*sizeof(unsigned int));
+        memcpy(samples + offset + propsSize, chunks[i].data.raw, chunks[i].info.baseSize - propsSize);
+
+        offset += chunks[i].info.baseSize;
+        sampleCount++;
+        sampleOffsets[sampleCount] = offset;
+    }
+
+    // Count samples containing every 8-byte sequence (hashed), sequences repeated in a sample are counted once
+    for (unsigned int s = 0; s < sampleCount; s++)
+    {
+        for (unsigned int i = sampleOffsets[s]; (i + 8) <= sampleOffsets[s + 1]; i++)
+        {
+            unsigned int hash = HashDictionarySequence(samples + i);
+
+            if (lastSample[hash] != (s + 1))
+            {
+                lastSample[hash] = s + 1;
+                counts[hash]++;
+            }
+        }
+    }
+
+    // Get candidate segments, scored by its sequences found in multiple samples
+    unsigned int segmentCount = 0;
+    for (unsigned int s = 0; s < sampleCount; s++) segmentCount += (sampleOffsets[s + 1] - sampleOffsets[s] + COMP_DICTIONARY_SEGMENT_SIZE - 1)/COMP_DICTIONARY_SEGMENT_SIZE;
+
+    DictionarySegment *segments = (DictionarySegment *)RL_CALLOC(segmentCount, sizeof(DictionarySegment));
+    segmentCount = 0;
+
+    for (unsigned int s = 0; s < sampleCount; s++)
+    {
+        for (unsigned int i = sampleOffsets[s]; (i + 8) <= sampleOffsets[s + 1]; i += COMP_DICTIONARY_SEGMENT_SIZE)
+        {
+            DictionarySegment *segment = &segments[segmentCount];
+            segment->offset = i;
+            segment->size = ((sampleOffsets[s + 1] - i) < COMP_DICTIONARY_SEGMENT_SIZE)? (sampleOffsets[s + 1] - i) : COMP_DICTIONARY_SEGMENT_SIZE;
+            segment->score = ScoreDictionarySegment(samples + segment->offset, segment->size, counts);
+            if (segment->score > 0) segmentCount++;
+        }
+    }
+
+    qsort(segments, segmentCount, sizeof(DictionarySegment), CompareDictionarySegments);
+
+    // Select best segments (greedy), sequences of selected segments are not scored again,
+    // scores are updated lazily: a segment is only selected if its updated score is still the best one
+    unsigned char *data = (unsigned char *)RL_MALLOC(size);
+    unsigned int dataSize = 0;
+
+    for (unsigned int i = 0; (i < segmentCount) && (dataSize < size); )
+    {
+        DictionarySegment *segment = &segments[i];
+        unsigned int score = ScoreDictionarySegment(samples + segment->offset, segment->size, counts);
+
+        if (score == 0) { i++; continue; }
+
+        if (((i + 1) < segmentCount) && (score < segments[i + 1].score))
+        {
+            // Segment score is not the best one any more, move it to its new position
+            DictionarySegment updated = *segment;
+            updated.score = score;
+
+            unsigned int k = i;
+            while (((k + 1) < segmentCount) && (segments[k + 1].score > score)) { segments[k] = segments[k + 1]; k++; }
+            segments[k] = updated;
+
+            continue;
+        }
+
+        // Segment selected, copied before the previously selected ones (dictionary is filled from the end)
+        unsigned int copySize = ((size - dataSize) < segment->size)? (size - dataSize) : segment->size;
+        memcpy(data + size - dataSize - copySize, samples + segment->offset + segment->size - copySize, copySize);
+        dataSize += copySize;
+
+        for (unsigned int k = 0; (k + 8) <= segment->size; k++) counts[HashDictionarySequence(samples + segment->offset + k)] = 0;
+
+        i++;
+    }
+
+    if (dataSize > 0)
+    {
+        // Dictionary chunk: propCount + props[0] (size) + data, not compressed
+        memmove(data, data + size - dataSize, dataSize);
+
+        memcpy(dictionary.info.type, "DICT", 4);
+        dictionary.info.id = rresComputeCRC32(data, dataSize);
+        dictionary.info.baseSize = 2*sizeof(unsigned int) + dataSize;
+        dictionary.info.packedSize = dictionary.info.baseSize;
+
+        dictionary.data.propCount = 1;
+        dictionary.data.props = (unsigned int *)RRES_CALLOC(1, sizeof(unsigned int));
+        dictionary.data.props[0] = dataSize;
+        dictionary.data.raw = RRES_MALLOC(dataSize);
+        memcpy(dictionary.data.raw, data, dataSize);
+
+        // CRC32 computed on data as stored in rres file: propCount + props[] + data
+        unsigned char *chunkData = (unsigned char *)RL_MALLOC(dictionary.info.baseSize);
+        memcpy(chunkData, &dictionary.data.propCount, sizeof(unsigned int));
+        memcpy(chunkData + sizeof(unsigned int), dictionary.data.props, sizeof(unsigned int));
+        memcpy(chunkData + 2*sizeof(unsigned int), data, dataSize);
+        dictionary.info.crc32 = rresComputeCRC32(chunkData, dictionary.info.baseSize);
+        RL_FREE(chunkData);
+
+        RRES_LOG("RRES: DICT: Compression dictionary generated: 0x%08x (%u bytes, %u samples)\n", dictionary.info.id, dataSize, sampleCount);
+    }
+    else RRES_LOG("RRES: WARNING: DICT: Compression dictionary could not be generated, no repeated data found\n");
+
+    RL_FREE(data);
+    RL_FREE(segments);
+    RL_FREE(lastSample);
+    RL_FREE(counts);
+    RL_FREE(sampleOffsets);
+    RL_FREE(samples);
+
+    return dictionary;
+}
+
+// Set compression dictionary used by PackResourceChunk()
+// NOTE: Dictionary data is copied, it's also available to unpack chunks compressed with it
+void SetCompressionDictionary(rresResourceChunk dictionary)
+{
+    compDictionary = -1;
+
+    if ((rresGetDataType(dictionary.info.type) == RRES_DATA_DICTIONARY) && (dictionary.data.propCount >= 1) && (dictionary.data.props != NULL) && (dictionary.data.raw != NULL))
+    {
+        compDictionary = AddCompressionDictionary((const unsigned char *)dictionary.data.raw, dictionary.data.props[0], NULL);
+    }
+}
+
+// Load compression dictionaries from rres file (FourCC: DICT)
+// NOTE: Dictionaries are only loaded once per file, already loaded dictionaries are kept
+int LoadCompressionDictionaries(const char *fileName)
+{
+    unsigned int fileId = rresComputeCRC32((const unsigned char *)fileName, (int)strlen(fileName));
+
+    for (unsigned int i = 0; i < compDictionaryCount; i++)
+    {
+        if ((compDictionaries[i].fileId == fileId) && (compDictionaries[i].fileName != NULL) && (strcmp(compDictionaries[i].fileName, fileName) == 0)) return compDictionaryCount;
+    }
+
+    unsigned int chunkCount = 0;
+    rresResourceChunkInfo *infos = rresLoadResourceChunkInfoAll(fileName, &chunkCount);
+
+    for (unsigned int i = 0; i < chunkCount; i++)
+    {
+        if (rresGetDataType(infos[i].type) != RRES_DATA_DICTIONARY) continue;
+
+        rresResourceChunk chunk = rresLoadResourceChunk(fileName, infos[i].id);
+
+        if ((chunk.data.raw != NULL) && (chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE) && (chunk.data.propCount >= 1) &&
+            (chunk.data.props[0] <= (chunk.info.baseSize - (1 + chunk.data.propCount)*sizeof(unsigned int))))
+        {
+            int index = AddCompressionDictionary((const unsigned char *)chunk.data.raw, chunk.data.props[0], fileName);
+            if ((index >= 0) && (compDictionaries[index].fileName == NULL)) SetCompressionDictionaryFile(&compDictionaries[index], fileName);
+        }
+        else RRES_LOG("RRES: WARNING: DICT: Compression dictionary not valid: 0x%08x\n", infos[i].id);
+
+        rresUnloadResourceChunk(chunk);
+    }
+
+    RRES_FREE(infos);
+
+    return compDictionaryCount;
+}
+
+// Unload all compression dictionaries
+void UnloadCompressionDictionaries(void)
+{
+    for (unsigned int i = 0; i < compDictionaryCount; i++)
+    {
+        RL_FREE(compDictionaries[i].data);
+        RRES_FREE(compDictionaries[i].fileName);
+    }
+
+    memset(compDictionaries, 0, sizeof(compDictionaries));
+    compDictionaryCount = 0;
+    compDictionary = -1;
+}
+
+// Set compression codec for compression algorithm
+// NOTE: Empty codec (no compression/decompression functions) unregisters the algorithm
+void SetCompressionCodec(int compType, CompressionCodec codec)
+{
+    if ((compType <= RRES_COMP_NONE) || (compType > 255)) return;
+
+    LoadDefaultCodecs();
+    compCodecs[compType] = codec;
+}
+
+// Set encryption cipher for encryption algorithm
+// NOTE: Empty cipher (no encryption/decryption functions) unregisters the algorithm
+void SetEncryptionCipher(int cipherType, EncryptionCipher cipher)
+{
+    if ((cipherType <= RRES_CIPHER_NONE) || (cipherType > 255)) return;
+
+    LoadDefaultCodecs();
+    encryptionCiphers[cipherType] = cipher;
+}
+
+// Set compression policy, used by SelectCompressionType()
+void SetCompressionPolicy(int policy, float minDecodeSpeed)
+{
+    compPolicy = policy;
+    compMinDecodeSpeed = (minDecodeSpeed > 0.0f)? minDecodeSpeed : 0.0f;
+}
+
+// Select compression algorithm for unpacked chunk data, by compression policy
+// NOTE 1: Data is compressed as PackResourceChunk() does (blocks or dictionary), with every codec registered,
+// compressed data not smaller than unpacked data is discarded, decompression is verified and timed (best of several runs)
+// NOTE 2: No compression (RRES_COMP_NONE) is selected if no codec reduces data size or fulfills the policy
+int SelectCompressionType(const rresResourceChunk *chunk)
+{
+    if ((chunk->info.compType != RRES_COMP_NONE) || (chunk->info.cipherType != RRES_CIPHER_NONE) || (chunk->data.raw == NULL)) return RRES_COMP_NONE;
+
+    int compType = RRES_COMP_NONE;
+    unsigned int bestSize = chunk->info.baseSize;
+    unsigned long long bestTime = 0;
+
+    // NOTE: Same data compressed by PackResourceChunk(), data filters requested are applied
+    unsigned char *unpackedData = LoadPackingData(chunk);
+    if (unpackedData == NULL) return RRES_COMP_NONE;
+
+    for (int i = RRES_COMP_NONE + 1; i < 256; i++)
+    {
+        const CompressionCodec *codec = GetCompressionCodec(i);
+
+        if ((codec == NULL) || (codec->compress == NULL) || ((codec->decompress == NULL) && (codec->decompressInto == NULL))) continue;
+
+        // NOTE: Same data layout selected by PackResourceChunk()
+        bool compDict = codec->dictionary && (compDictionary >= 0) && ((compBlockSize == 0) || (chunk->info.baseSize <= compBlockSize));
+        bool compBlocks = !compDict && codec->blocks && (compBlockSize > 0);
+        const CompressionDictionary *dictionary = compDict? &compDictionaries[compDictionary] : NULL;
+
+        unsigned char *compData = NULL;
+        unsigned int compDataSize = 0;
+
+        if (compBlocks) compData = CompressDataBlocks(unpackedData, chunk->info.baseSize, codec, compBlockSize, &compDataSize);
+        else if (compDict) compData = codec->compress(unpackedData, chunk->info.baseSize, dictionary->data, dictionary->size, &compDataSize);
+        else compData = codec->compress(unpackedData, chunk->info.baseSize, NULL, 0, &compDataSize);
+
+        // NOTE: Dictionary id is appended to data compressed with dictionary
+        unsigned int packedSize = compDataSize + (compDict? sizeof(unsigned int) : 0);
+
+        if ((compData != NULL) && (compDataSize > 0) && (packedSize < chunk->info.baseSize))
+        {
+            unsigned long long time = MeasureDecompressTime(compData, compDataSize, codec, compBlocks, dictionary, unpackedData, chunk->info.baseSize);
+
+            if (time > 0)
+            {
+                // NOTE: Decompression speed in MB/s: bytes/ns*1000
+                float speed = (float)((double)chunk->info.baseSize*1000.0/(double)time);
+                bool selected = false;
+
+                switch (compPolicy)
+                {
+                    case COMPRESSION_POLICY_SPEED: selected = (compType == RRES_COMP_NONE) || (time < bestTime); break;
+                    case COMPRESSION_POLICY_BUDGET: selected = (speed >= compMinDecodeSpeed) && (packedSize < bestSize); break;
+                    case COMPRESSION_POLICY_SIZE:
+                    default: selected = (packedSize < bestSize); break;
+                }
+
+                if (selected)
+                {
+                    compType = i;
+                    bestSize = packedSize;
+                    bestTime = time;
+                }
+            }
+            else RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data decompression failed, codec not selected: %s\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3], (codec->name != NULL)? codec->name : "unnamed");
+        }
+
+        RL_FREE(compData);
+    }
+
+    RL_FREE(unpackedData);
+
+    // Register selection in compression report, per chunk type and compression algorithm
+    CompressionReportEntry *entry = NULL;
+
+    for (unsigned int i = 0; i < compReportCount; i++)
+    {
+        if ((memcmp(compReport[i].type, chunk->info.type, 4) == 0) && (compReport[i].compType == compType)) { entry = &compReport[i]; break; }
+    }
+
+    if ((entry == NULL) && (compReportCount < COMP_REPORT_MAX))
+    {
+        entry = &compReport[compReportCount];
+        compReportCount++;
+
+        memset(entry, 0, sizeof(CompressionReportEntry));
+        memcpy(entry->type, chunk->info.type, 4);
+        entry->compType = compType;
+    }
+
+    if (entry != NULL)
+    {
+        entry->count++;
+        entry->baseSize += chunk->info.baseSize;
+        entry->compSize += bestSize;
+        entry->decodeTime += bestTime;
+    }
+
+    return compType;
+}
+
+// Log compression selection summary per chunk type
+// NOTE: Report is cleared once logged
+void LogCompressionReport(void)
+{
+    unsigned long long baseSize = 0;
+    unsigned long long compSize = 0;
+
+    RRES_LOG("RRES: INFO: Compression report (policy: %s)\n", (compPolicy == COMPRESSION_POLICY_SPEED)? "speed" : (compPolicy == COMPRESSION_POLICY_BUDGET)? "budget" : "size");
+
+    for (unsigned int i = 0; i < compReportCount; i++)
+    {
+        const CompressionReportEntry *entry = &compReport[i];
+        const CompressionCodec *codec = GetCompressionCodec(entry->compType);
+        const char *name = (entry->compType == RRES_COMP_NONE)? "NONE" : ((codec != NULL) && (codec->name != NULL))? codec->name : "unknown";
+
+        // NOTE: Decompression speed is not available for data not compressed
+        float speed = (entry->decodeTime > 0)? (float)((double)entry->baseSize*1000.0/(double)entry->decodeTime) : 0.0f;
+
+        RRES_LOG("RRES: INFO:     > %c%c%c%c | %-12s | chunks: %4u | size: %10llu -> %10llu (%5.1f%%) | decode: %9.1f MB/s\n",
+            entry->type[0], entry->type[1], entry->type[2], entry->type[3], name, entry->count, entry->baseSize, entry->compSize,
+            (entry->baseSize > 0)? (float)entry->compSize*100.0f/(float)entry->baseSize : 100.0f, speed);
+        (void)name; (void)speed;    // Not used if RRES_LOG() is compiled out
+
+        baseSize += entry->baseSize;
+        compSize += entry->compSize;
+    }
+
+    RRES_LOG("RRES: INFO: Compression report total size: %llu -> %llu (%.1f%%)\n", baseSize, compSize, (baseSize > 0)? (float)compSize*100.0f/(float)baseSize : 100.0f);
+
+    compReportCount = 0;
+}
+
+// Set threads used to unpack large chunks (0: CPU cores available)
+void SetUnpackThreadCount(int count)
+{
+    unpackThreads = (count > 0)? count : 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load data chunk: RRES_DATA_LINK
+static void *LoadDataFromResourceLink(rresResourceChunk chunk, unsigned int *size)
+{
+    char fullFilePath[2048] = { 0 };
+    void *data = NULL;
+    *size = 0;
+
+    // Get external link filepath
+    char *linkFilePath = (char *)RL_CALLOC(chunk.data.props[0], 1);
+    if (linkFilePath != NULL) memcpy(linkFilePath, chunk.data.raw, chunk.data.props[0]);
+
+    // Get base directory to append filepath if not provided by user
+    if (baseDir == NULL) baseDir = GetApplicationDirectory();
+
+    strcpy(fullFilePath, baseDir);
+    strcat(fullFilePath, linkFilePath);
+
+    RRES_LOG("RRES: %c%c%c%c: Data file linked externally: %s\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3], linkFilePath);
+
+    if (FileExists(fullFilePath))
+    {
+        // Load external file as raw data
+        // NOTE: We check if file is a text file to allow automatic line-endings processing
+        if (IsFileExtension(linkFilePath, ".txt;.md;.vs;.fs;.info;.c;.h;.json;.xml;.glsl"))     // Text file
+        {
+            data = LoadFileText(fullFilePath);
+            *size = TextLength((char *)data);
+        }
+        else data = LoadFileData(fullFilePath, (int *)size);
+
+        if ((data != NULL) && (*size > 0)) RRES_LOG("RRES: %c%c%c%c: External linked file loaded successfully\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+    }
+    else RRES_LOG("RRES: WARNING: [%s] Linked external file could not be found\n", linkFilePath);
+
+    return data;
+}
+
+// Load data chunk: RRES_DATA_RAW
+// NOTE: This chunk can be used raw files embedding or other binary blobs
+static void *LoadDataFromResourceChunk(rresResourceChunk chunk, unsigned int *size)
+{
+    void *rawData = NULL;
+
+    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+    {
+        rawData = RL_CALLOC(chunk.data.props[0], 1);
+        if (rawData != NULL) memcpy(rawData, chunk.data.raw, chunk.data.props[0]);
+        *size = chunk.data.props[0];
+    }
+    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+
+    return rawData;
+}
+
+// Load data chunk: RRES_DATA_TEXT
+// NOTE: This chunk can be used for shaders or other text data elements (materials?)
+static char *LoadTextFromResourceChunk(rresResourceChunk chunk, unsigned int *codeLang)
+{
+    char *text = NULL;
+
+    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+    {
+        text = (char *)RL_CALLOC(chunk.data.props[0] + 1, 1);   // We add NULL terminator, just in case
+        if (text != NULL) memcpy(text, chunk.data.raw, chunk.data.props[0]);
+
+        // TODO: We got some extra text properties, in case they could be useful for users:
+        // chunk.props[1]:rresTextEncoding, chunk.props[2]:rresCodeLang, chunk. props[3]:cultureCode
+        *codeLang = chunk.data.props[2];
+        //chunks.props[3]:cultureCode could be useful for localized text
+    }
+    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+
+    return text;
+}
+
+// Load data chunk: RRES_DATA_IMAGE
+// NOTE 1: Many data types use images data in some way (font, material...)
+// NOTE 2: QOI compressed chunks (not encrypted) are directly decoded into image data, no need to unpack them
+// NOTE 3: If requested, image data takes chunk data (no copy), image.data equals chunk.data.raw in that case
+static Image LoadImageFromResourceChunk(rresResourceChunk chunk, bool moveData)
+{
+    Image image = { 0 };
+
+    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+    {
+        image.width = chunk.data.props[0];
+        image.height = chunk.data.props[1];
+        int format = chunk.data.props[2];
+
+        // Assign equivalent pixel formats for our engine
+        // NOTE: In this case rresPixelFormat defined values match raylib PixelFormat values
+        switch (format)
+        {
+            case RRES_PIXELFORMAT_UNCOMP_GRAYSCALE: image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE; break;
+            case RRES_PIXELFORMAT_UNCOMP_GRAY_ALPHA: image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA; break;
+            case RRES_PIXELFORMAT_UNCOMP_R5G6B5: image.format = PIXELFORMAT_UNCOMPRESSED_R5G6B5; break;
+            case RRES_PIXELFORMAT_UNCOMP_R8G8B8: image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8; break;
+            case RRES_PIXELFORMAT_UNCOMP_R5G5B5A1: image.format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1; break;
+            case RRES_PIXELFORMAT_UNCOMP_R4G4B4A4: image.format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4; break;
+            case RRES_PIXELFORMAT_UNCOMP_R8G8B8A8: image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8; break;
+            case RRES_PIXELFORMAT_UNCOMP_R32: image.format = PIXELFORMAT_UNCOMPRESSED_R32; break;
+            case RRES_PIXELFORMAT_UNCOMP_R32G32B32: image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32; break;
+            case RRES_PIXELFORMAT_UNCOMP_R32G32B32A32: image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32; break;
+            case RRES_PIXELFORMAT_COMP_DXT1_RGB: image.format = PIXELFORMAT_COMPRESSED_DXT1_RGB; break;
+            case RRES_PIXELFORMAT_COMP_DXT1_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_DXT3_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_DXT5_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_ETC1_RGB: image.format = PIXELFORMAT_COMPRESSED_ETC1_RGB; break;
+            case RRES_PIXELFORMAT_COMP_ETC2_RGB: image.format = PIXELFORMAT_COMPRESSED_ETC2_RGB; break;
+            case RRES_PIXELFORMAT_COMP_ETC2_EAC_RGBA: image.format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_PVRT_RGB: image.format = PIXELFORMAT_COMPRESSED_PVRT_RGB; break;
+            case RRES_PIXELFORMAT_COMP_PVRT_RGBA: image.format = PIXELFORMAT_COMPRESSED_PVRT_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_ASTC_4x4_RGBA: image.format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_ASTC_8x8_RGBA: image.format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA; break;
+            default: break;
+        }
+
+        image.mipmaps = chunk.data.props[3];
+
+        // Image data size can be computed from image properties
+        unsigned int size = GetPixelDataSize(image.width, image.height, image.format);
+
+        // NOTE: Computed image data must match the data size of the chunk processed (minus propCount + props[] size)
+        if (size == (chunk.info.baseSize - (1 + chunk.data.propCount)*sizeof(unsigned int)))
+        {
+            image.data = LoadResourceChunkRaw(&chunk, size, moveData);
+        }
+        else RRES_LOG("RRES: WARNING: IMGE: Chunk data size do not match expected image data size\n");
+    }
+    else if (IsImageChunkQOI(chunk))
+    {
+        // QOI compressed image (not encrypted): pixels decoded directly into image data, no intermediate buffers,
+        // image properties read from QOI header, image size must match chunk data size (propCount + props[4] + pixels)
+        unsigned int width = 0, height = 0, channels = 0;
+
+        if ((chunk.data.raw != NULL) && LoadQOIHeader((const unsigned char *)chunk.data.raw, chunk.info.packedSize, &width, &height, &channels) &&
+            (((unsigned long long)width*height*channels + 5*sizeof(unsigned int)) == chunk.info.baseSize))
+        {
+            RRES_STATS_BEGIN(decompTimer);
+            RRES_TRACE_BEGIN(decompSpan);
+            image.data = RL_MALLOC(width*height*channels);
+
+            if ((image.data != NULL) && DecodeImageQOI((const unsigned char *)chunk.data.raw, chunk.info.packedSize, (unsigned char *)image.data, width*height*channels))
+            {
+                image.width = width;
+                image.height = height;
+                image.format = (channels == 4)? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 : PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+                image.mipmaps = 1;
+            }
+            else
+            {
+                RL_FREE(image.data);
+                image.data = NULL;
+                RRES_LOG("RRES: WARNING: IMGE: Chunk data decompression failed\n");
+            }
+            RRES_TRACE_END(RRES_TRACE_DECOMPRESS, chunk.info.id, chunk.info.type, decompSpan);
+            RRES_STATS_END(RRES_STATS_EVENT_DECOMPRESS, RRES_COMP_QOI, decompTimer);
+        }
+        else RRES_LOG("RRES: WARNING: IMGE: Chunk data size do not match expected image data size\n");
+    }
+    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+
+    return image;
+}
+
+// Load data chunks: RRES_DATA_VERTEX
+// NOTE 1: We try to load vertex data following raylib structure constraints,
+// in case data does not fit raylib Mesh structure, it is not loaded
+// NOTE 2: If requested, mesh arrays take chunks data (no copy), moved chunks data is set to NULL
+static Mesh LoadMeshFromResourceChunks(rresResourceMulti multi, bool moveData)
+{
+    Mesh mesh = { 0 };
+
+    // TODO: Support externally linked mesh resource?
+
+    // Mesh resource consist of (n) chunks:
+    for (unsigned int i = 0; i < multi.count; i++)
+    {
+        if ((multi.chunks[0].info.compType == RRES_COMP_NONE) && (multi.chunks[0].info.cipherType == RRES_CIPHER_NONE) &&
+            (multi.chunks[i].info.compType == RRES_COMP_NONE) && (multi.chunks[i].info.cipherType == RRES_CIPHER_NONE))
+        {
+            // NOTE: raylib only supports vertex arrays with same vertex count,
+            // rres.chunks[0] defined vertexCount will be the reference for the following chunks
+            // The only exception to vertexCount is the mesh.indices array
+            if (mesh.vertexCount == 0) mesh.vertexCount = multi.chunks[0].data.props[0];
+
+            // Verify chunk type and vertex count
+            if (rresGetDataType(multi.chunks[i].info.type) == RRES_DATA_VERTEX)
+            {
+                // In case vertex count do not match we skip that resource chunk
+                if ((multi.chunks[i].data.props[1] != RRES_VERTEX_ATTRIBUTE_INDEX) && (multi.chunks[i].data.props[0] != (unsigned int)mesh.vertexCount)) continue;
+
+                // NOTE: We are only loading raylib supported rresVertexFormat and raylib expected components count
+                switch (multi.chunks[i].data.props[1])    // Check rresVertexAttribute value
+                {
+                    case RRES_VERTEX_ATTRIBUTE_POSITION:
+                    {
+                        // raylib expects 3 components per vertex and float vertex format (half-float, snorm16 and unorm16 expanded to float)
+                        if ((multi.chunks[i].data.props[2] == 3) && IsVertexFormatFloat(multi.chunks[i].data.props[3]))
+                        {
+                            mesh.vertices = LoadVertexAttributeFloat(&multi.chunks[i], mesh.vertexCount, moveData);
+                        }
+                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute position not valid, componentCount/vertexFormat do not fit\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD1:
+                    {
+                        // raylib expects 2 components per vertex and float vertex format (half-float, snorm16 and unorm16 expanded to float)
+                        if ((multi.chunks[i].data.props[2] == 2) && IsVertexFormatFloat(multi.chunks[i].data.props[3]))
+                        {
+                            mesh.texcoords = LoadVertexAttributeFloat(&multi.chunks[i], mesh.vertexCount, moveData);
+                        }
+                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord1 not valid, componentCount/vertexFormat do not fit\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD2:
+                    {
+                        // raylib expects 2 components per vertex and float vertex format (half-float, snorm16 and unorm16 expanded to float)
+                        if ((multi.chunks[i].data.props[2] == 2) && IsVertexFormatFloat(multi.chunks[i].data.props[3]))
+                        {
+                            mesh.texcoords2 = LoadVertexAttributeFloat(&multi.chunks[i], mesh.vertexCount, moveData);
+                        }
+                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord2 not valid, componentCount/vertexFormat do not fit\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD3:
+                    {
+                        RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord3 not supported\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD4:
+                    {
+                        RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord4 not supported\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_NORMAL:
+                    {
+                        // raylib expects 3 components per vertex and float vertex format (half-float, snorm16 and unorm16 expanded to float)
+                        if ((multi.chunks[i].data.props[2] == 3) && IsVertexFormatFloat(multi.chunks[i].data.props[3]))
+                        {
+                            mesh.normals = LoadVertexAttributeFloat(&multi.chunks[i], mesh.vertexCount, moveData);
+                        }
+                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute normal not valid, componentCount/vertexFormat do not fit\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_TANGENT:
+                    {
+                        // raylib expects 4 components per vertex and float vertex format (half-float, snorm16 and unorm16 expanded to float)
+                        if ((multi.chunks[i].data.props[2] == 4) && IsVertexFormatFloat(multi.chunks[i].data.props[3]))
+                        {
+                            mesh.tangents = LoadVertexAttributeFloat(&multi.chunks[i], mesh.vertexCount, moveData);
+                        }
+                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute tangent not valid, componentCount/vertexFormat do not fit\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_COLOR:
+                    {
+                        // raylib expects 4 components per vertex and unsigned char vertex format
+                        if ((multi.chunks[i].data.props[2] == 4) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_UBYTE))
+                        {
+                            mesh.colors = (unsigned char *)LoadResourceChunkRaw(&multi.chunks[i], mesh.vertexCount*4*sizeof(unsigned char), moveData);
+                        }
+                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute color not valid, componentCount/vertexFormat do not fit\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_INDEX:
+                    {
+                        // raylib expects 1 components per index and unsigned short vertex format
+                        if ((multi.chunks[i].data.props[2] == 1) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_USHORT))
+                        {
+                            mesh.indices = (unsigned short *)LoadResourceChunkRaw(&multi.chunks[i], multi.chunks[i].data.props[0]*sizeof(unsigned short), moveData);
+                        }
+                        else if ((multi.chunks[i].data.props[2] == 1) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_UINT))
+                        {
+                            // 32-bit indices converted to 16-bit (in place), only if all indices fit 16 bits
+                            unsigned int indexCount = 0;
+                            unsigned int *indices = LoadIndicesFromResourceChunk(&multi.chunks[i], &indexCount, moveData);
+                            bool fit = (indices != NULL);
+
+                            for (unsigned int k = 0; fit && (k < indexCount); k++) if (indices[k] > 0xffff) fit = false;
+
+                            if (fit)
+                            {
+                                for (unsigned int k = 0; k < indexCount; k++)
+                                {
+                                    unsigned short index = (unsigned short)indices[k];
+                                    memcpy((unsigned char *)indices + k*sizeof(unsigned short), &index, sizeof(unsigned short));
+                                }
+
+                                // NOTE: Indices array shrinked, keep original array if shrink fails
+                                void *shrinked = RL_REALLOC(indices, (indexCount > 0)? indexCount*sizeof(unsigned short) : 1);
+                                mesh.indices = (unsigned short *)((shrinked != NULL)? shrinked : (void *)indices);
+                            }
+                            else
+                            {
+                                RL_FREE(indices);
+                                RRES_LOG("RRES: WARNING: MESH: Vertex attribute index not valid, raylib Mesh only supports 16-bit indices\n");
+                            }
+                        }
+                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute index not valid, componentCount/vertexFormat do not fit\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_INTERLEAVED:
+                    {
+                        // Interleaved vertex data is read once, raylib supported attributes are de-interleaved into mesh arrays
+                        VertexBuffer buffer = { 0 };
+
+                        if (LoadVertexBufferLayout(multi.chunks[i], &buffer))
+                        {
+                            buffer.data = multi.chunks[i].data.raw;
+                            LoadMeshVertexBuffer(&mesh, buffer);
+                        }
+                        else RRES_LOG("RRES: WARNING: MESH: Vertex attributes interleaved not valid, layout does not fit data\n");
+
+                    } break;
+                    default: break;
+                }
+            }
+        }
+        else RRES_LOG("RRES: WARNING: Vertex provided data must be decompressed/decrypted\n");
+    }
+
+    return mesh;
+}
+
+// Load chunk raw data: moved or copied, size must fit chunk data
+// NOTE: Moved data is owned by caller, chunk->data.raw is set to NULL (chunk can still be unloaded)
+static void *LoadResourceChunkRaw(rresResourceChunk *chunk, unsigned int size, bool moveData)
+{
+    void *rawData = NULL;
+
+    if ((chunk->data.raw == NULL) || (((unsigned long long)size + (1 + chunk->data.propCount)*sizeof(unsigned int)) > chunk->info.baseSize))
+    {
+        RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data size smaller than expected data size\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+    }
+    else if (moveData)
+    {
+        rawData = chunk->data.raw;
+        chunk->data.raw = NULL;
+    }
+    else
+    {
+        rawData = RL_CALLOC(size, 1);
+        if (rawData != NULL) memcpy(rawData, chunk->data.raw, size);
+    }
+
+    return rawData;
+}
+
+// Unpack chunk to be consumed (if required), chunk data size checked
+static bool UnpackResourceChunkConsume(rresResourceChunk *chunk)
+{
+    bool unpacked = true;
+
+    if ((chunk->info.compType != RRES_COMP_NONE) || (chunk->info.cipherType != RRES_CIPHER_NONE)) unpacked = (UnpackResourceChunk(chunk) == 0);
+
+    return unpacked && (chunk->data.raw != NULL) && (((1 + (unsigned long long)chunk->data.propCount)*sizeof(unsigned int)) <= chunk->info.baseSize);
+}
+
+// Check chunk is a QOI compressed image, directly decoded into image data
+// NOTE: Only chunks not encrypted and not filtered, while the built-in QOI codec is registered
+static bool IsImageChunkQOI(rresResourceChunk chunk)
+{
+    const CompressionCodec *codec = GetCompressionCodec(RRES_COMP_QOI);
+
+    return (chunk.info.compType == RRES_COMP_QOI) && (chunk.info.cipherType == RRES_CIPHER_NONE) && ((chunk.info.flags & FILTER_FLAGS) == 0) &&
+        (codec != NULL) && (codec->decompressInto == DecompressDataQOI);
+}
+
+// Load interleaved vertex data layout from chunk props: stride and attributes (format, components, offset)
+// NOTE: Attributes must fit in vertex stride and vertex data (vertexCount*stride) must fit chunk data
+static bool LoadVertexBufferLayout(rresResourceChunk chunk, VertexBuffer *buffer)
+{
+    const unsigned int *props = chunk.data.props;
+
+    if ((rresGetDataType(chunk.info.type) != RRES_DATA_VERTEX) || (chunk.data.propCount < 4) || (props == NULL) ||
+        (props[1] != RRES_VERTEX_ATTRIBUTE_INTERLEAVED)) return false;
+
+    if ((props[0] == 0) || (props[2] == 0) || (props[2] > RRES_VERTEX_ATTRIBUTES_MAX) || (props[3] == 0) ||
+        (chunk.data.propCount < (4 + 4*props[2])) || (chunk.data.raw == NULL) ||
+        (((unsigned long long)props[0]*props[3] + (1 + chunk.data.propCount)*sizeof(unsigned int)) > chunk.info.baseSize))
+    {
+        RRES_LOG("RRES: WARNING: VRTX: Interleaved vertex data layout not valid\n");
+        return false;
+    }
+
+    buffer->vertexCount = props[0];
+    buffer->attributeCount = props[2];
+    buffer->stride = props[3];
+
+    for (unsigned int i = 0; i < buffer->attributeCount; i++)
+    {
+        VertexAttributeDesc *desc = &buffer->attributes[i];
+        desc->attribute = props[4 + 4*i];
+        desc->componentCount = props[5 + 4*i];
+        desc->format = props[6 + 4*i];
+        desc->offset = props[7 + 4*i];
+
+        if ((desc->componentCount == 0) || (desc->componentCount > 4) || (GetVertexFormatSize(desc->format) == 0) ||
+            (((unsigned long long)desc->offset + desc->componentCount*GetVertexFormatSize(desc->format)) > buffer->stride))
+        {
+            RRES_LOG("RRES: WARNING: VRTX: Interleaved vertex attribute %u not valid, it does not fit vertex stride\n", i);
+            memset(buffer, 0, sizeof(VertexBuffer));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Load Mesh arrays from interleaved vertex data, raylib supported attributes de-interleaved
+// NOTE 1: Vertex data is read once (vertex by vertex), attributes already loaded in mesh are skipped
+// NOTE 2: Quantized attributes are expanded to float, normalized values (no scale/offset)
+static void LoadMeshVertexBuffer(Mesh *mesh, VertexBuffer buffer)
+{
+    static const float scale[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    static const float offset[4] = { 0 };
+
+    unsigned char *arrays[RRES_VERTEX_ATTRIBUTES_MAX] = { 0 };
+    unsigned int offsets[RRES_VERTEX_ATTRIBUTES_MAX] = { 0 };
+    unsigned int sizes[RRES_VERTEX_ATTRIBUTES_MAX] = { 0 };
+    unsigned int count = 0;
+
+    for (unsigned int i = 0; i < buffer.attributeCount; i++)
+    {
+        VertexAttributeDesc desc = buffer.attributes[i];
+        unsigned int componentCount = 0;
+        unsigned int format = 0;
+
+        if (GetMeshAttribute(*mesh, desc.attribute, &componentCount, &format) != NULL) continue;
+
+        if ((componentCount > 0) && (desc.componentCount == componentCount) && (desc.format != format) &&
+            (format == RRES_VERTEX_FORMAT_FLOAT) && IsVertexFormatFloat(desc.format))
+        {
+            float *array = (float *)RL_MALLOC((size_t)buffer.vertexCount*componentCount*sizeof(float));
+
+            if (array != NULL)
+            {
+                DequantizeVertexData(array, (const unsigned char *)buffer.data + desc.offset, buffer.vertexCount, componentCount, desc.format, scale, offset, buffer.stride);
+                SetMeshAttribute(mesh, desc.attribute, array);
+            }
+        }
+        else if ((componentCount > 0) && (desc.componentCount == componentCount) && (desc.format == format))
+        {
+            sizes[count] = componentCount*GetVertexFormatSize(format);
+            arrays[count] = (unsigned char *)RL_MALLOC((size_t)buffer.vertexCount*sizes[count]);
+            offsets[count] = desc.offset;
+
+            if (arrays[count] != NULL)
+            {
+                SetMeshAttribute(mesh, desc.attribute, arrays[count]);
+                count++;
+            }
+        }
+        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute %u not valid, attribute/componentCount/vertexFormat do not fit\n", desc.attribute);
+    }
+
+    const unsigned char *vertex = (const unsigned char *)buffer.data;
+
+    for (unsigned int v = 0; v < buffer.vertexCount; v++, vertex += buffer.stride)
+    {
+        for (unsigned int i = 0; i < count; i++) memcpy(arrays[i] + (size_t)v*sizes[i], vertex + offsets[i], sizes[i]);
+    }
+}
+
+// Get Mesh array for vertex attribute and its raylib expected layout (components count and format)
+// NOTE: Components count is 0 for attributes not supported by raylib Mesh
+static void *GetMeshAttribute(Mesh mesh, unsigned int attribute, unsigned int *componentCount, unsigned int *format)
+{
+    void *array = NULL;
+
+    *componentCount = 0;
+    *format = RRES_VERTEX_FORMAT_FLOAT;
+
+    switch (attribute)
+    {
+        case RRES_VERTEX_ATTRIBUTE_POSITION: array = mesh.vertices; *componentCount = 3; break;
+        case RRES_VERTEX_ATTRIBUTE_TEXCOORD1: array = mesh.texcoords; *componentCount = 2; break;
+        case RRES_VERTEX_ATTRIBUTE_TEXCOORD2: array = mesh.texcoords2; *componentCount = 2; break;
+        case RRES_VERTEX_ATTRIBUTE_NORMAL: array = mesh.normals; *componentCount = 3; break;
+        case RRES_VERTEX_ATTRIBUTE_TANGENT: array = mesh.tangents; *componentCount = 4; break;
+        case RRES_VERTEX_ATTRIBUTE_COLOR: array = mesh.colors; *componentCount = 4; *format = RRES_VERTEX_FORMAT_UBYTE; break;
+        default: break;
+    }
+
+    return array;
+}
+
+// Set Mesh array for vertex attribute
+static void SetMeshAttribute(Mesh *mesh, unsigned int attribute, void *array)
+{
+    switch (attribute)
+    {
+        case RRES_VERTEX_ATTRIBUTE_POSITION: mesh->vertices = (float *)array; break;
+        case RRES_VERTEX_ATTRIBUTE_TEXCOORD1: mesh->texcoords = (float *)array; break;
+        case RRES_VERTEX_ATTRIBUTE_TEXCOORD2: mesh->texcoords2 = (float *)array; break;
+        case RRES_VERTEX_ATTRIBUTE_NORMAL: mesh->normals = (float *)array; break;
+        case RRES_VERTEX_ATTRIBUTE_TANGENT: mesh->tangents = (float *)array; break;
+        case RRES_VERTEX_ATTRIBUTE_COLOR: mesh->colors = (unsigned char *)array; break;
+        default: break;
+    }
+}
+
+// Get vertex format component size (bytes), 0 if not valid
+static unsigned int GetVertexFormatSize(unsigned int format)
+{
+    unsigned int size = 0;
+
+    switch (format)
+    {
+        case RRES_VERTEX_FORMAT_UBYTE:
+        case RRES_VERTEX_FORMAT_BYTE: size = 1; break;
+        case RRES_VERTEX_FORMAT_USHORT:
+        case RRES_VERTEX_FORMAT_SHORT:
+        case RRES_VERTEX_FORMAT_HFLOAT: size = 2; break;
+        case RRES_VERTEX_FORMAT_UINT:
+        case RRES_VERTEX_FORMAT_INT:
+        case RRES_VERTEX_FORMAT_FLOAT: size = 4; break;
+        default: break;
+    }
+
+    return size;
+}
+
+// Check vertex format is float or quantized float: half-float, snorm16 (SHORT), unorm16 (USHORT)
+static bool IsVertexFormatFloat(unsigned int format)
+{
+    return (format == RRES_VERTEX_FORMAT_FLOAT) || (format == RRES_VERTEX_FORMAT_HFLOAT) ||
+        (format == RRES_VERTEX_FORMAT_SHORT) || (format == RRES_VERTEX_FORMAT_USHORT);
+}
+
+// Load vertex attribute as float array (props[2] components per vertex), quantized data expanded to float
+// NOTE: Float data can be moved (no copy), quantized data is expanded into a new array (chunk data not modified)
+static float *LoadVertexAttributeFloat(rresResourceChunk *chunk, unsigned int vertexCount, bool moveData)
+{
+    unsigned int componentCount = chunk->data.props[2];
+    unsigned int format = chunk->data.props[3];
+    float *values = NULL;
+
+    if (format == RRES_VERTEX_FORMAT_FLOAT) return (float *)LoadResourceChunkRaw(chunk, vertexCount*componentCount*sizeof(float), moveData);
+
+    if ((chunk->data.raw == NULL) || (((unsigned long long)vertexCount*componentCount*2 + (1 + chunk->data.propCount)*sizeof(unsigned int)) > chunk->info.baseSize))
+    {
+        RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data size smaller than expected data size\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        return NULL;
+    }
+
+    // Scale/offset per component, stored as float bits (optional)
+    float scale[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    float offset[4] = { 0 };
+
+    if (chunk->data.propCount >= (4 + 2*componentCount))
+    {
+        memcpy(scale, chunk->data.props + 4, componentCount*sizeof(float));
+        memcpy(offset, chunk->data.props + 4 + componentCount, componentCount*sizeof(float));
+    }
+
+    values = (float *)RL_MALLOC((size_t)vertexCount*componentCount*sizeof(float));
+    if (values != NULL) DequantizeVertexData(values, (const unsigned char *)chunk->data.raw, vertexCount, componentCount, format, scale, offset, componentCount*2);
+
+    return values;
+}
+
+// Load vertex indices as 32-bit values: RRES_VERTEX_FORMAT_USHORT (converted) or RRES_VERTEX_FORMAT_UINT
+// NOTE: If requested, 32-bit indices take chunk data (no copy), moved chunk data is set to NULL
+static unsigned int *LoadIndicesFromResourceChunk(rresResourceChunk *chunk, unsigned int *count, bool moveData)
+{
+    unsigned int *indices = NULL;
+    *count = 0;
+
+    if ((rresGetDataType(chunk->info.type) != RRES_DATA_VERTEX) || (chunk->data.propCount < 4) || (chunk->data.props == NULL) ||
+        (chunk->data.props[1] != RRES_VERTEX_ATTRIBUTE_INDEX) || (chunk->data.props[2] != 1) || (chunk->data.props[0] > (0xffffffff/sizeof(unsigned int))))
+    {
+        RRES_LOG("RRES: WARNING: VRTX: Chunk data is not vertex indices data\n");
+        return NULL;
+    }
+
+    unsigned int indexCount = chunk->data.props[0];
+
+    if (chunk->data.props[3] == RRES_VERTEX_FORMAT_UINT) indices = (unsigned int *)LoadResourceChunkRaw(chunk, indexCount*sizeof(unsigned int), moveData);
+    else if (chunk->data.props[3] == RRES_VERTEX_FORMAT_USHORT)
+    {
+        if ((chunk->data.raw != NULL) && (((unsigned long long)indexCount*sizeof(unsigned short) + (1 + chunk->data.propCount)*sizeof(unsigned int)) <= chunk->info.baseSize))
+        {
+            indices = (unsigned int *)RL_MALLOC((indexCount > 0)? indexCount*sizeof(unsigned int) : 1);
+
+            if (indices != NULL)
+            {
+                const unsigned short *values = (const unsigned short *)chunk->data.raw;
+                for (unsigned int i = 0; i < indexCount; i++) indices[i] = values[i];
+            }
+        }
+        else RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data size smaller than expected data size\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+    }
+    else RRES_LOG("RRES: WARNING: VRTX: Vertex indices format not supported\n");
+
+    if (indices != NULL) *count = indexCount;
+
+    return indices;
+}
+
+// Reorder triangles for post-transform vertex cache locality (Tipsify), indices reordered in place
+// NOTE: Triangles around a fanning vertex are emitted together, next fanning vertex is the emitted vertex with triangles left
+// expected to be still in cache, otherwise last emitted vertices with triangles left (dead-end stack) and then input order,
+// linear time, vertices in cache are identified by timestamps (FIFO cache of VERTEX_CACHE_SIZE vertices)
+static bool OptimizeVertexCache(unsigned int *indices, unsigned int indexCount, unsigned int vertexCount)
+{
+    unsigned int triangleCount = indexCount/3;
+    unsigned int *offsets = (unsigned int *)RL_CALLOC((size_t)vertexCount + 1, sizeof(unsigned int));    // Vertex triangles offset in adjacency
+    unsigned int *liveCount = (unsigned int *)RL_CALLOC(vertexCount, sizeof(unsigned int));              // Vertex triangles not emitted
+    unsigned int *timestamps = (unsigned int *)RL_CALLOC(vertexCount, sizeof(unsigned int));             // Vertex cache insertion time
+    unsigned int *adjacency = (unsigned int *)RL_MALLOC(((size_t)indexCount + 1)*sizeof(unsigned int));   // Triangles per vertex
+    unsigned int *deadEnd = (unsigned int *)RL_MALLOC(((size_t)indexCount + 1)*sizeof(unsigned int));     // Emitted vertices stack
+    unsigned int *output = (unsigned int *)RL_MALLOC(((size_t)indexCount + 1)*sizeof(unsigned int));
+    unsigned char *emitted = (unsigned char *)RL_CALLOC((size_t)triangleCount + 1, 1);
+    bool success = (offsets != NULL) && (liveCount != NULL) && (timestamps != NULL) && (adjacency != NULL) && (deadEnd != NULL) && (output != NULL) && (emitted != NULL);
+
+    if (success && (triangleCount > 0))
+    {
+        // Vertex-triangle adjacency, timestamps used as fill cursor
+        for (unsigned int i = 0; i < triangleCount*3; i++) liveCount[indices[i]]++;
+        for (unsigned int v = 0; v < vertexCount; v++) offsets[v + 1] = offsets[v] + liveCount[v];
+        for (unsigned int i = 0; i < triangleCount*3; i++) { adjacency[offsets[indices[i]] + timestamps[indices[i]]] = i/3; timestamps[indices[i]]++; }
+        memset(timestamps, 0, (size_t)vertexCount*sizeof(unsigned int));
+
+        unsigned int time = VERTEX_CACHE_SIZE + 1;
+        unsigned int cursor = 0;
+        unsigned int deadEndCount = 0;
+        unsigned int outputCount = 0;
+        int fanning = indices[0];
+
+        while (fanning >= 0)
+        {
+            unsigned int start = outputCount;
+
+            // Emit fanning vertex triangles not emitted yet
+            for (unsigned int k = offsets[fanning]; k < offsets[fanning + 1]; k++)
+            {
+                unsigned int t = adjacency[k];
+
+                if (emitted[t]) continue;
+
+                for (int j = 0; j < 3; j++)
+                {
+                    unsigned int v = indices[3*t + j];
+
+                    output[outputCount++] = v;
+                    deadEnd[deadEndCount++] = v;
+                    liveCount[v]--;
+
+                    if ((time - timestamps[v]) > VERTEX_CACHE_SIZE) timestamps[v] = time++;
+                }
+
+                emitted[t] = 1;
+            }
+
+            // Next fanning vertex: emitted vertices with triangles left, oldest in cache if still in cache after its triangles emitted
+            int best = -1;
+            int bestPriority = -1;
+
+            for (unsigned int k = start; k < outputCount; k++)
+            {
+                unsigned int v = output[k];
+
+                if (liveCount[v] > 0)
+                {
+                    int priority = ((time - timestamps[v] + 2*liveCount[v]) <= VERTEX_CACHE_SIZE)? (int)(time - timestamps[v]) : 0;
+                    if (priority > bestPriority) { best = (int)v; bestPriority = priority; }
+                }
+            }
+
+            // Dead-end: last emitted vertices with triangles left, then vertices in input order
+            while ((best < 0) && (deadEndCount > 0))
+            {
+                unsigned int v = deadEnd[--deadEndCount];
+                if (liveCount[v] > 0) best = (int)v;
+            }
+
+            for (; (best < 0) && (cursor < vertexCount); cursor++) if (liveCount[cursor] > 0) best = (int)cursor;
+
+            fanning = best;
+        }
+
+        // NOTE: All triangles must be emitted, indices are not modified otherwise
+        if (outputCount == triangleCount*3) memcpy(indices, output, (size_t)triangleCount*3*sizeof(unsigned int));
+        else success = false;
+    }
+
+    RL_FREE(offsets);
+    RL_FREE(liveCount);
+    RL_FREE(timestamps);
+    RL_FREE(adjacency);
+    RL_FREE(deadEnd);
+    RL_FREE(output);
+    RL_FREE(emitted);
+
+    return success;
+}
+
+// Get file extension from RRES_DATA_RAW properties (unsigned int)
+static const char *GetExtensionFromProps(unsigned int ext01, unsigned int ext02)
+{
+    static char extension[8] = { 0 };
+    memset(extension, 0, 8);
+
+    // Convert file extension provided as 2 unsigned int properties, to a char[] array
+    // NOTE: Extension is defined as 2 unsigned int big-endian values (4 bytes each),
+    // starting with a dot, i.e 0x2e706e67 => ".png"
+    extension[0] = (unsigned char)((ext01 & 0xff000000) >> 24);
+    extension[1] = (unsigned char)((ext01 & 0x00ff0000) >> 16);
+    extension[2] = (unsigned char)((ext01 & 0x0000ff00) >> 8);
+    extension[3] = (unsigned char)(ext01 & 0x000000ff);
+
+    extension[4] = (unsigned char)((ext02 & 0xff000000) >> 24);
+    extension[5] = (unsigned char)((ext02 & 0x00ff0000) >> 16);
+    extension[6] = (unsigned char)((ext02 & 0x0000ff00) >> 8);
+    extension[7] = (unsigned char)(ext02 & 0x000000ff);
+
+    return extension;
+}
+
+// Copy file name string, required to identify file on hash match
+static char *CopyFileName(const char *fileName)
+{
+    size_t length = strlen(fileName);
+    char *copy = (char *)RRES_MALLOC(length + 1);
+
+    if (copy != NULL) memcpy(copy, fileName, length + 1);
+
+    return copy;
+}
+
+// Evict unreferenced cached chunks until cache fits budget
+// NOTE: Least-recently-released chunks are evicted first (LRU list tail), referenced chunks are never evicted
+static void EvictResourceCache(unsigned int budget)
+{
+    while ((cache.stats.usedBytes > budget) && (cache.unusedTail != NULL))
+    {
+        ResourceCacheEntry *entry = cache.unusedTail;
+        ResourceCacheEntry **link = &cache.buckets[RESOURCE_CACHE_HASH(entry->fileId, entry->rresId)];
+        ResourceCacheEntry **chunkLink = &cache.chunkBuckets[RESOURCE_CACHE_CHUNK_HASH(&entry->chunk)];
+
+        UnlinkResourceCacheUnused(entry);
+
+        while (*link != entry) link = &(*link)->nextHash;
+        *link = entry->nextHash;
+        while (*chunkLink != entry) chunkLink = &(*chunkLink)->nextChunk;
+        *chunkLink = entry->nextChunk;
+
+        cache.stats.count--;
+        cache.stats.usedBytes -= entry->size;
+        cache.stats.evictions++;
+
+        rresUnloadResourceChunk(entry->chunk);
+        RRES_FREE(entry->fileName);
+        RRES_FREE(entry);
+    }
+}
+
+// Add cache entry to LRU list, as most recently released
+static void LinkResourceCacheUnused(ResourceCacheEntry *entry)
+{
+    entry->prevUnused = NULL;
+    entry->nextUnused = cache.unusedHead;
+
+    if (cache.unusedHead != NULL) cache.unusedHead->prevUnused = entry;
+    else cache.unusedTail = entry;
+
+    cache.unusedHead = entry;
+}
+
+// Remove cache entry from LRU list
+static void UnlinkResourceCacheUnused(ResourceCacheEntry *entry)
+{
+    if (entry->prevUnused != NULL) entry->prevUnused->nextUnused = entry->nextUnused;
+    else cache.unusedHead = entry->nextUnused;
+
+    if (entry->nextUnused != NULL) entry->nextUnused->prevUnused = entry->prevUnused;
+    else cache.unusedTail = entry->prevUnused;
+
+    entry->prevUnused = NULL;
+    entry->nextUnused = NULL;
+}
+
+// Register built-in compression codecs and encryption ciphers (if supported)
+// NOTE: Codecs are registered once, on first codec/cipher request, user codecs replace them
+static void LoadDefaultCodecs(void)
+{
+    if (codecsLoaded) return;
+
+    codecsLoaded = true;
+
+    // NOTE: Registry arrays are zero-initialized, only supported functions are set
+    compCodecs[RRES_COMP_DEFLATE].name = "DEFLATE";
+    compCodecs[RRES_COMP_DEFLATE].compress = CompressDataDEFLATE;
+#if defined(RRES_DEFLATE_USE_RAYLIB)
+    compCodecs[RRES_COMP_DEFLATE].decompress = DecompressDataDEFLATE;
+#else
+    compCodecs[RRES_COMP_DEFLATE].decompressInto = DecompressDataInflate;
+#endif
+    compCodecs[RRES_COMP_DEFLATE].blocks = true;
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+    compCodecs[RRES_COMP_LZ4].name = "LZ4";
+    compCodecs[RRES_COMP_LZ4].compress = CompressDataLZ4;
+    compCodecs[RRES_COMP_LZ4].decompressInto = DecompressDataLZ4;
+    compCodecs[RRES_COMP_LZ4].blocks = true;
+    compCodecs[RRES_COMP_LZ4].dictionary = true;
+#endif
+    compCodecs[RRES_COMP_QOI].name = "QOI";
+    compCodecs[RRES_COMP_QOI].compress = CompressDataQOI;
+    compCodecs[RRES_COMP_QOI].decompressInto = DecompressDataQOI;
+    compCodecs[RRES_COMP_INDEX_DELTA].name = "INDEX";
+    compCodecs[RRES_COMP_INDEX_DELTA].compress = CompressDataIndices;
+    compCodecs[RRES_COMP_INDEX_DELTA].decompressInto = DecompressDataIndices;
+
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+    encryptionCiphers[RRES_CIPHER_AES].name = "AES";
+    encryptionCiphers[RRES_CIPHER_AES].encrypt = EncryptDataAES;
+    encryptionCiphers[RRES_CIPHER_AES].decrypt = DecryptDataAES;
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+    encryptionCiphers[RRES_CIPHER_XCHACHA20_POLY1305].name = "XChaCha20";
+    encryptionCiphers[RRES_CIPHER_XCHACHA20_POLY1305].encrypt = EncryptDataXChaCha20;
+    encryptionCiphers[RRES_CIPHER_XCHACHA20_POLY1305].decrypt = DecryptDataXChaCha20;
+    encryptionCiphers[RRES_CIPHER_XCHACHA20_POLY1305_SEGMENTED].name = "XChaCha20, segments";
+    encryptionCiphers[RRES_CIPHER_XCHACHA20_POLY1305_SEGMENTED].encrypt = EncryptDataXChaCha20Segments;
+    encryptionCiphers[RRES_CIPHER_XCHACHA20_POLY1305_SEGMENTED].decrypt = DecryptDataXChaCha20Segments;
+    encryptionCiphers[RRES_CIPHER_XCHACHA20_POLY1305_SEGMENTED].decryptRange = LoadDecryptedRangeXChaCha20Segments;
+#endif
+}
+
+// Get compression codec registered for compType, NULL if not supported
+static const CompressionCodec *GetCompressionCodec(int compType)
+{
+    if ((compType <= RRES_COMP_NONE) || (compType > 255)) return NULL;
+
+    LoadDefaultCodecs();
+
+    const CompressionCodec *codec = &compCodecs[compType];
+
+    if ((codec->compress == NULL) && (codec->decompress == NULL) && (codec->decompressInto == NULL)) return NULL;
+
+    return codec;
+}
+
+// Get encryption cipher registered for cipherType, NULL if not supported
+static const EncryptionCipher *GetEncryptionCipher(int cipherType)
+{
+    if ((cipherType <= RRES_CIPHER_NONE) || (cipherType > 255)) return NULL;
+
+    LoadDefaultCodecs();
+
+    const EncryptionCipher *cipher = &encryptionCiphers[cipherType];
+
+    if ((cipher->encrypt == NULL) && (cipher->decrypt == NULL) && (cipher->decryptRange == NULL)) return NULL;
+
+    return cipher;
+}
+
+// Measure data decompression time (ns), best time of several decompressions
+// NOTE: Decompressed data is verified, 0 is returned if decompression fails or data does not match
+static unsigned long long MeasureDecompressTime(const unsigned char *compData, unsigned int compSize, const CompressionCodec *codec, bool compBlocks, const CompressionDictionary *dictionary, const unsigned char *data, unsigned int size)
+{
+    unsigned long long bestTime = 0;
+    unsigned long long totalTime = 0;
+    unsigned char *output = (unsigned char *)RL_MALLOC(size);
+
+    for (int i = 0; (i < COMP_TRIAL_ITERATIONS) && (totalTime < COMP_TRIAL_TIME); i++)
+    {
+        bool decompressed = false;
+        unsigned long long time = rresGetTimeNs();
+
+        if (compBlocks) decompressed = DecompressDataBlocks(compData, compSize, codec, output, size);
+        else if (codec->decompressInto != NULL) decompressed = codec->decompressInto(compData, compSize, (dictionary != NULL)? dictionary->data : NULL, (dictionary != NULL)? dictionary->size : 0, output, size);
+        else
+        {
+            // NOTE: Allocation is included in decompression time, as done on unpacking
+            unsigned int dataSize = 0;
+            unsigned char *decompData = codec->decompress(compData, compSize, &dataSize);
+
+            decompressed = (decompData != NULL) && (dataSize == size);
+            if (decompressed) memcpy(output, decompData, size);
+            RRES_FREE(decompData);
+        }
+
+        time = rresGetTimeNs() - time;
+        if (time == 0) time = 1;    // Timer resolution not enough, 1 ns minimum
+
+        // Decompressed data verified on first iteration
+        if (!decompressed || ((i == 0) && (memcmp(output, data, size) != 0)))
+        {
+            bestTime = 0;
+            break;
+        }
+
+        if ((bestTime == 0) || (time < bestTime)) bestTime = time;
+        totalTime += time;
+    }
+
+    RL_FREE(output);
+
+    return bestTime;
+}
+
+// Compression codec: DEFLATE, compress data (raylib)
+static unsigned char *CompressDataDEFLATE(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned int *compSize)
+{
+    (void)dictionary; (void)dictionarySize;     // Dictionary not supported
+
+    int deflateSize = 0;
+    unsigned char *compData = CompressData(data, size, &deflateSize);
+
+    *compSize = (deflateSize > 0)? (unsigned int)deflateSize : 0;
+
+    return compData;
+}
+
+#if defined(RRES_DEFLATE_USE_RAYLIB)
+// Compression codec: DEFLATE, decompress data (raylib)
+// TODO: WARNING: Possible issue with allocators: RL_CALLOC() vs RRES_CALLOC()
+static unsigned char *DecompressDataDEFLATE(const unsigned char *data, unsigned int size, unsigned int *dataSize)
+{
+    int inflateSize = 0;
+    unsigned char *output = DecompressData(data, size, &inflateSize);
+
+    *dataSize = (inflateSize > 0)? (unsigned int)inflateSize : 0;
+
+    return output;
+}
+#endif
+
+#if !defined(RRES_DEFLATE_USE_RAYLIB)
+// Compression codec: DEFLATE, decompress data into output (bundled inflate decoder)
+// NOTE: Raw DEFLATE stream (no zlib header), output size must match decompressed data size
+static bool DecompressDataInflate(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned char *output, unsigned int outputSize)
+{
+    (void)dictionary; (void)dictionarySize;     // Dictionary not supported
+
+    InflateState *state = (InflateState *)RL_CALLOC(1, sizeof(InflateState));
+    if (state == NULL) return false;
+
+    state->in = data;
+    state->inEnd = data + size;
+    state->output = output;
+    state->out = output;
+    state->outEnd = output + outputSize;
+
+    bool valid = true;
+    bool final = false;
+    bool fixedTables = false;       // Fixed Huffman codes tables loaded, reused by consecutive fixed blocks
+
+    while (valid && !final)
+    {
+        // Block header: final block (1 bit) + block type (2 bits)
+        RefillInflateBits(state);
+        final = ((state->bitBuffer & 1) != 0);
+        unsigned int type = (unsigned int)(state->bitBuffer >> 1) & 3;
+        state->bitBuffer >>= 3;
+        state->bitCount -= 3;
+
+        switch (type)
+        {
+            case 0: valid = InflateStoredBlock(state); break;
+            case 1:
+            {
+                if (!fixedTables) valid = LoadInflateFixedTables(state);
+                fixedTables = valid;
+                valid = valid && InflateHuffmanBlock(state);
+            } break;
+            case 2:
+            {
+                fixedTables = false;
+                valid = LoadInflateDynamicTables(state) && InflateHuffmanBlock(state);
+            } break;
+            default: valid = false; break;
+        }
+    }
+
+    // Data must be fully decompressed, without reading past input data end
+    valid = valid && (state->out == state->outEnd) && ((state->overrun*8) <= state->bitCount);
+
+    RL_FREE(state);
+
+    return valid;
+}
+
+// Refill inflate bit buffer, at least 56 bits available
+// NOTE: Input is read in 64-bit words while available, zero bytes are added past input end (counted as overrun)
+static void RefillInflateBits(InflateState *state)
+{
+    if ((state->inEnd - state->in) >= 8)
+    {
+        unsigned long long word = 0;
+        memcpy(&word, state->in, 8);    // WARNING: Little-endian word expected
+        state->bitBuffer |= word << state->bitCount;
+        state->in += (63 - state->bitCount) >> 3;
+        state->bitCount |= 56;
+    }
+    else while (state->bitCount < 56)
+    {
+        if (state->in < state->inEnd) state->bitBuffer |= (unsigned long long)(*state->in++) << state->bitCount;
+        else state->overrun++;
+        state->bitCount += 8;
+    }
+}
+
+// Inflate stored block: LEN + NLEN (byte aligned) + data, copied to output
+static bool InflateStoredBlock(InflateState *state)
+{
+    // Bit buffer is aligned to byte, the bytes not consumed are returned to input
+    state->bitBuffer >>= (state->bitCount & 7);
+    state->bitCount &= ~7u;
+
+    if ((state->overrun*8) > state->bitCount) return false;
+
+    state->in -= (state->bitCount/8 - state->overrun);
+    state->bitBuffer = 0;
+    state->bitCount = 0;
+    state->overrun = 0;
+
+    if ((state->inEnd - state->in) < 4) return false;
+
+    unsigned int length = state->in[0] | (state->in[1] << 8);
+    unsigned int lengthCheck = state->in[2] | (state->in[3] << 8);
+    state->in += 4;
+
+    if ((length != (~lengthCheck & 0xffff)) || (length > (size_t)(state->inEnd - state->in)) || (length > (size_t)(state->outEnd - state->out))) return false;
+
+    memcpy(state->out, state->in, length);
+    state->in += length;
+    state->out += length;
+
+    return true;
+}
+
+// Inflate block compressed with Huffman codes (fixed or dynamic), decode tables must be loaded
+// NOTE: Bit buffer is refilled once per symbol, a length/distance pair requires 48 bits max:
+// literal/length code (15) + length extra bits (5) + distance code (15) + distance extra bits (13)
+static bool InflateHuffmanBlock(InflateState *state)
+{
+    const unsigned int *litlenTable = state->litlenTable;
+    const unsigned int *distTable = state->distTable;
+    const unsigned char *in = state->in;
+    const unsigned char *inEnd = state->inEnd;
+    const unsigned char *output = state->output;
+    unsigned char *out = state->out;
+    unsigned char *outEnd = state->outEnd;
+    unsigned long long bitBuffer = state->bitBuffer;
+    unsigned int bitCount = state->bitCount;
+    unsigned int overrun = state->overrun;
+    bool valid = true;
+
+    while (true)
+    {
+        // Refill bit buffer, same as RefillInflateBits(), kept in registers
+        if ((inEnd - in) >= 8)
+        {
+            unsigned long long word = 0;
+            memcpy(&word, in, 8);
+            bitBuffer |= word << bitCount;
+            in += (63 - bitCount) >> 3;
+            bitCount |= 56;
+        }
+        else
+        {
+            while (bitCount < 56)
+            {
+                if (in < inEnd) bitBuffer |= (unsigned long long)(*in++) << bitCount;
+                else overrun++;
+                bitCount += 8;
+            }
+
+            // Data read past input end
+            if ((overrun*8) > bitCount) { valid = false; break; }
+        }
+
+        // Literal/length symbol, codes longer than table bits decoded with subtable
+        unsigned int entry = litlenTable[bitBuffer & ((1 << INFLATE_LITLEN_TABLE_BITS) - 1)];
+
+        if (INFLATE_ENTRY_KIND(entry) == INFLATE_SUBTABLE)
+        {
+            bitBuffer >>= INFLATE_LITLEN_TABLE_BITS;
+            bitCount -= INFLATE_LITLEN_TABLE_BITS;
+            entry = litlenTable[INFLATE_ENTRY_VALUE(entry) + (bitBuffer & ((1u << INFLATE_ENTRY_EXTRA(entry)) - 1))];
+        }
+
+        bitBuffer >>= INFLATE_ENTRY_BITS(entry);
+        bitCount -= INFLATE_ENTRY_BITS(entry);
+
+        unsigned int kind = INFLATE_ENTRY_KIND(entry);
+
+        if (kind == INFLATE_LITERAL)
+        {
+            if (out == outEnd) { valid = false; break; }
+            *out++ = (unsigned char)INFLATE_ENTRY_VALUE(entry);
+            continue;
+        }
+        else if (kind == INFLATE_LITERALS)
+        {
+            // Multi-symbol entry: two literals decoded at once
+            if ((outEnd - out) < 2) { valid = false; break; }
+            out[0] = (unsigned char)INFLATE_ENTRY_VALUE(entry);
+            out[1] = (unsigned char)(INFLATE_ENTRY_VALUE(entry) >> 8);
+            out += 2;
+            continue;
+        }
+        else if (kind == INFLATE_END) break;
+        else if (kind != INFLATE_BASE) { valid = false; break; }
+
+        // Match length: base + extra bits
+        unsigned int length = INFLATE_ENTRY_VALUE(entry) + (unsigned int)(bitBuffer & ((1u << INFLATE_ENTRY_EXTRA(entry)) - 1));
+        bitBuffer >>= INFLATE_ENTRY_EXTRA(entry);
+        bitCount -= INFLATE_ENTRY_EXTRA(entry);
+
+        // Match distance: distance symbol base + extra bits
+        entry = distTable[bitBuffer & ((1 << INFLATE_DIST_TABLE_BITS) - 1)];
+
+        if (INFLATE_ENTRY_KIND(entry) == INFLATE_SUBTABLE)
+        {
+            bitBuffer >>= INFLATE_DIST_TABLE_BITS;
+            bitCount -= INFLATE_DIST_TABLE_BITS;
+            entry = distTable[INFLATE_ENTRY_VALUE(entry) + (bitBuffer & ((1u << INFLATE_ENTRY_EXTRA(entry)) - 1))];
+        }
+
+        if (INFLATE_ENTRY_KIND(entry) != INFLATE_BASE) { valid = false; break; }
+
+        bitBuffer >>= INFLATE_ENTRY_BITS(entry);
+        bitCount -= INFLATE_ENTRY_BITS(entry);
+
+        unsigned int distance = INFLATE_ENTRY_VALUE(entry) + (unsigned int)(bitBuffer & ((1u << INFLATE_ENTRY_EXTRA(entry)) - 1));
+        bitBuffer >>= INFLATE_ENTRY_EXTRA(entry);
+        bitCount -= INFLATE_ENTRY_EXTRA(entry);
+
+        if ((distance > (size_t)(out - output)) || (length > (size_t)(outEnd - out))) { valid = false; break; }
+
+        // Match copy: previous output data, word-sized copies if match does not overlap a word
+        // NOTE: Up to 7 bytes can be written past match end, they are overwritten by next symbols
+        const unsigned char *src = out - distance;
+
+        if ((distance >= 8) && ((size_t)(outEnd - out) >= (length + 8)))
+        {
+            unsigned char *end = out + length;
+
+            do
+            {
+                memcpy(out, src, 8);
+                out += 8;
+                src += 8;
+            } while (out < end);
+
+            out = end;
+        }
+        else if (distance == 1)
+        {
+            memset(out, *src, length);
+            out += length;
+        }
+        else
+        {
+            for (unsigned int i = 0; i < length; i++) out[i] = src[i];
+            out += length;
+        }
+    }
+
+    state->in = in;
+    state->out = out;
+    state->bitBuffer = bitBuffer;
+    state->bitCount = bitCount;
+    state->overrun = overrun;
+
+    return valid;
+}
+
+// Load inflate decode tables for fixed Huffman codes
+static bool LoadInflateFixedTables(InflateState *state)
+{
+    unsigned char lengths[288 + 32] = { 0 };
+
+    for (int i = 0; i < 144; i++) lengths[i] = 8;
+    for (int i = 144; i < 256; i++) lengths[i] = 9;
+    for (int i = 256; i < 280; i++) lengths[i] = 7;
+    for (int i = 280; i < 288; i++) lengths[i] = 8;
+    for (int i = 288; i < 288 + 32; i++) lengths[i] = 5;
+
+    return BuildInflateTable(state->litlenTable, INFLATE_LITLEN_TABLE_BITS, lengths, 288, INFLATE_LITLEN, true) &&
+           BuildInflateTable(state->distTable, INFLATE_DIST_TABLE_BITS, lengths + 288, 32, INFLATE_DIST, false);
+}
+
+// Load inflate decode tables for dynamic Huffman codes, code lengths read from block header
+// NOTE: Code lengths are compressed with a code lengths Huffman code (precode), including repeat symbols (16, 17, 18)
+static bool LoadInflateDynamicTables(InflateState *state)
+{
+    static const unsigned char precodeOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+    unsigned char precodeLengths[19] = { 0 };
+    unsigned char lengths[288 + 32] = { 0 };
+
+    RefillInflateBits(state);
+    unsigned int litlenCount = (unsigned int)(state->bitBuffer & 31) + 257;
+    unsigned int distCount = (unsigned int)((state->bitBuffer >> 5) & 31) + 1;
+    unsigned int precodeCount = (unsigned int)((state->bitBuffer >> 10) & 15) + 4;
+    state->bitBuffer >>= 14;
+    state->bitCount -= 14;
+
+    if (litlenCount > 286) return false;
+
+    for (unsigned int i = 0; i < precodeCount; i++)
+    {
+        RefillInflateBits(state);
+        precodeLengths[precodeOrder[i]] = (unsigned char)(state->bitBuffer & 7);
+        state->bitBuffer >>= 3;
+        state->bitCount -= 3;
+    }
+
+    if (!BuildInflateTable(state->precodeTable, INFLATE_PRECODE_TABLE_BITS, precodeLengths, 19, INFLATE_PRECODE, false)) return false;
+
+    // Literal/length and distance code lengths, repeat symbols can cross from one code to the other
+    unsigned int count = litlenCount + distCount;
+
+    for (unsigned int i = 0; i < count; )
+    {
+        RefillInflateBits(state);
+        unsigned int entry = state->precodeTable[state->bitBuffer & ((1 << INFLATE_PRECODE_TABLE_BITS) - 1)];
+
+        if (INFLATE_ENTRY_KIND(entry) != INFLATE_LITERAL) return false;
+
+        state->bitBuffer >>= INFLATE_ENTRY_BITS(entry);
+        state->bitCount -= INFLATE_ENTRY_BITS(entry);
+
+        unsigned int symbol = INFLATE_ENTRY_VALUE(entry);
+        unsigned int repeat = 0;
+        unsigned char length = 0;
+
+        if (symbol < 16)
+        {
+            lengths[i++] = (unsigned char)symbol;
+            continue;
+        }
+        else if (symbol == 16)
+        {
+            // Repeat previous code length: 3-6 times
+            if (i == 0) return false;
+            length = lengths[i - 1];
+            repeat = 3 + (unsigned int)(state->bitBuffer & 3);
+            state->bitBuffer >>= 2;
+            state->bitCount -= 2;
+        }
+        else if (symbol == 17)
+        {
+            // Repeat zero code length: 3-10 times
+            repeat = 3 + (unsigned int)(state->bitBuffer & 7);
+            state->bitBuffer >>= 3;
+            state->bitCount -= 3;
+        }
+        else
+        {
+            // Repeat zero code length: 11-138 times
+            repeat = 11 + (unsigned int)(state->bitBuffer & 127);
+            state->bitBuffer >>= 7;
+            state->bitCount -= 7;
+        }
+
+        if ((i + repeat) > count) return false;
+
+        memset(lengths + i, length, repeat);
+        i += repeat;
+    }
+
+    // End of block code is required
+    if (lengths[256] == 0) return false;
+
+    return BuildInflateTable(state->litlenTable, INFLATE_LITLEN_TABLE_BITS, lengths, litlenCount, INFLATE_LITLEN, true) &&
+           BuildInflateTable(state->distTable, INFLATE_DIST_TABLE_BITS, lengths + litlenCount, distCount, INFLATE_DIST, false);
+}
+
+// Build inflate decode table from canonical Huffman code lengths, returns false if code is oversubscribed
+// NOTE 1: Codes are read LSB-first, table is indexed by bit-reversed codes, every code entry is replicated
+// for all the unused table bits, codes longer than table bits are decoded with a subtable (sized for the longest code)
+// NOTE 2: Literal/length table can store two literals per entry (multi-symbol), if both codes fit in table bits
+static bool BuildInflateTable(unsigned int *table, unsigned int tableBits, const unsigned char *lengths, unsigned int count, int alphabet, bool literalPairs)
+{
+    // Length and distance symbols base and extra bits
+    static const unsigned short lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const unsigned char lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const unsigned short distBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static const unsigned char distExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    unsigned int lengthCount[16] = { 0 };
+    unsigned int nextCode[16] = { 0 };
+    unsigned int codes[288] = { 0 };
+    unsigned char subtableBits[1 << INFLATE_LITLEN_TABLE_BITS] = { 0 };
+    unsigned int tableSize = 1u << tableBits;
+    int left = 1;
+
+    // Check code is not oversubscribed (incomplete codes are allowed, unused entries are invalid)
+    for (unsigned int i = 0; i < count; i++) lengthCount[lengths[i]]++;
+    for (int len = 1; len < 16; len++)
+    {
+        left = 2*left - (int)lengthCount[len];
+        if (left < 0) return false;
+    }
+
+    // Canonical codes, bit-reversed
+    lengthCount[0] = 0;
+    for (int len = 1; len < 15; len++) nextCode[len + 1] = (nextCode[len] + lengthCount[len]) << 1;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        unsigned int len = lengths[i];
+        if (len == 0) continue;
+
+        unsigned int code = nextCode[len]++;
+        unsigned int reversed = 0;
+        for (unsigned int b = 0; b < len; b++) reversed |= ((code >> b) & 1) << (len - 1 - b);
+        codes[i] = reversed;
+
+        // Subtable bits required by table entry (codes prefix)
+        if ((len > tableBits) && ((len - tableBits) > subtableBits[reversed & (tableSize - 1)])) subtableBits[reversed & (tableSize - 1)] = (unsigned char)(len - tableBits);
+    }
+
+    for (unsigned int i = 0; i < tableSize; i++) table[i] = INFLATE_ENTRY(0, 0, INFLATE_INVALID, 0);
+
+    // Subtables are stored after main table
+    unsigned int offset = tableSize;
+
+    for (unsigned int i = 0; i < tableSize; i++)
+    {
+        if (subtableBits[i] == 0) continue;
+
+        table[i] = INFLATE_ENTRY(tableBits, subtableBits[i], INFLATE_SUBTABLE, offset);
+        for (unsigned int j = 0; j < (1u << subtableBits[i]); j++) table[offset + j] = INFLATE_ENTRY(0, 0, INFLATE_INVALID, 0);
+        offset += (1u << subtableBits[i]);
+    }
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        unsigned int len = lengths[i];
+        if (len == 0) continue;
+
+        // Symbol entry: literal, end of block, length/distance base + extra bits
+        unsigned int entry = INFLATE_ENTRY(0, 0, INFLATE_INVALID, 0);
+
+        if (alphabet == INFLATE_LITLEN)
+        {
+            if (i < 256) entry = INFLATE_ENTRY(0, 0, INFLATE_LITERAL, i);
+            else if (i == 256) entry = INFLATE_ENTRY(0, 0, INFLATE_END, 0);
+            else if (i < 286) entry = INFLATE_ENTRY(0, lengthExtra[i - 257], INFLATE_BASE, lengthBase[i - 257]);
+        }
+        else if (alphabet == INFLATE_DIST)
+        {
+            if (i < 30) entry = INFLATE_ENTRY(0, distExtra[i], INFLATE_BASE, distBase[i]);
+        }
+        else entry = INFLATE_ENTRY(0, 0, INFLATE_LITERAL, i);
+
+        if (len <= tableBits)
+        {
+            for (unsigned int j = codes[i]; j < tableSize; j += (1u << len)) table[j] = entry | len;
+        }
+        else
+        {
+            unsigned int prefix = codes[i] & (tableSize - 1);
+            unsigned int *subtable = table + INFLATE_ENTRY_VALUE(table[prefix]);
+
+            for (unsigned int j = (codes[i] >> tableBits); j < (1u << subtableBits[prefix]); j += (1u << (len - tableBits))) subtable[j] = entry | (len - tableBits);
+        }
+    }
+
+    // Multi-symbol entries: literal code followed by another literal code, both fitting in table bits
+    // NOTE: Next code entry is read from the table index with the remaining bits, entries processed in descending order
+    // so the entries read (lower index) are still single symbol entries
+    if (literalPairs)
+    {
+        for (int i = (int)tableSize - 1; i >= 0; i--)
+        {
+            unsigned int entry = table[i];
+            unsigned int bits = INFLATE_ENTRY_BITS(entry);
+
+            if ((INFLATE_ENTRY_KIND(entry) != INFLATE_LITERAL) || (bits == 0)) continue;
+
+            unsigned int next = table[(unsigned int)i >> bits];
+
+            if ((INFLATE_ENTRY_KIND(next) == INFLATE_LITERAL) && ((bits + INFLATE_ENTRY_BITS(next)) <= tableBits))
+            {
+                table[i] = INFLATE_ENTRY(bits + INFLATE_ENTRY_BITS(next), 0, INFLATE_LITERALS, INFLATE_ENTRY_VALUE(entry) | (INFLATE_ENTRY_VALUE(next) << 8));
+            }
+        }
+    }
+
+    return true;
+}
+#endif
+
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+// Compression codec: LZ4, compress data (dictionary optional)
+static unsigned char *CompressDataLZ4(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned int *compSize)
+{
+    int bound = LZ4_compressBound(size);
+    unsigned char *compData = (unsigned char *)RL_MALLOC((bound > 0)? bound : 1);
+    int lz4Size = 0;
+
+    if (compData == NULL) return NULL;
+
+    if (dictionary != NULL)
+    {
+        LZ4_stream_t stream;
+        LZ4_initStream(&stream, sizeof(LZ4_stream_t));
+        LZ4_loadDict(&stream, (const char *)dictionary, dictionarySize);
+
+        lz4Size = LZ4_compress_fast_continue(&stream, (const char *)data, (char *)compData, size, bound, 1);
+    }
+    else lz4Size = LZ4_compress_default((const char *)data, (char *)compData, size, bound);
+
+    *compSize = (lz4Size > 0)? (unsigned int)lz4Size : 0;
+
+    return compData;
+}
+
+// Compression codec: LZ4, decompress data into output (dictionary optional)
+// WARNING: Decompression could be successful but not the original message size returned
+static bool DecompressDataLZ4(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned char *output, unsigned int outputSize)
+{
+    int lz4Size = 0;
+
+    if (dictionary != NULL) lz4Size = LZ4_decompress_safe_usingDict((const char *)data, (char *)output, size, outputSize, (const char *)dictionary, dictionarySize);
+    else lz4Size = LZ4_decompress_safe((const char *)data, (char *)output, size, outputSize);
+
+    return ((lz4Size >= 0) && ((unsigned int)lz4Size == outputSize));
+}
+#endif
+
+// Compression codec: QOI, compress image pixels
+// NOTE 1: Data is unpacked image data (propCount + props[] + pixels), only RGB/RGBA images with one mipmap level supported,
+// image props are not stored, they are reconstructed from QOI header on decompression
+// NOTE 2: If compression block size is set, image is split in horizontal stripes (complete rows, about block size),
+// stripes are encoded as independent QOI images, in parallel, and can be decoded in parallel
+static unsigned char *CompressDataQOI(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned int *compSize)
+{
+    (void)dictionary; (void)dictionarySize;     // Dictionary not supported
+
+    unsigned char *compData = NULL;
+    unsigned int props[5] = { 0 };      // propCount + props[4]: width, height, format, mipmaps
+    *compSize = 0;
+
+    if (size >= sizeof(props)) memcpy(props, data, sizeof(props));
+
+    if ((props[0] >= 4) && (props[4] <= 1) && ((props[3] == RRES_PIXELFORMAT_UNCOMP_R8G8B8) || (props[3] == RRES_PIXELFORMAT_UNCOMP_R8G8B8A8)))
+    {
+        qoi_desc desc = { 0 };
+        desc.width = props[1];
+        desc.height = props[2];
+        desc.channels = (props[3] == RRES_PIXELFORMAT_UNCOMP_R8G8B8A8)? 4 : 3;
+        desc.colorspace = QOI_SRGB;
+
+        unsigned int propsSize = (1 + props[0])*sizeof(unsigned int);
+
+        // Image rows per stripe (compression block size, if set), every stripe is encoded as an independent QOI image
+        unsigned long long rowSize = (unsigned long long)desc.width*desc.channels;
+        unsigned int stripeRows = ((compBlockSize > 0) && (rowSize > 0))? (unsigned int)((compBlockSize + rowSize - 1)/rowSize) : desc.height;
+
+        if ((propsSize <= size) && ((unsigned long long)desc.width*desc.height*desc.channels == (size - propsSize)))
+        {
+            if (stripeRows >= desc.height)
+            {
+                int qoiSize = 0;
+
+                // TODO: WARNING: Possible issue with allocators: QOI_MALLOC() vs RL_MALLOC()
+                compData = (unsigned char *)qoi_encode(data + propsSize, &desc, &qoiSize);
+                *compSize = (qoiSize > 0)? (unsigned int)qoiSize : 0;
+            }
+            else
+            {
+                // Image stripes encoded in parallel (if possible), stripes data stored after stripes index
+                // NOTE: QOI stripes data: "qois" + width + height + channels + stripeRows + stripeCount + offsets[stripeCount + 1] + stripes,
+                // offsets relative to stripes data start
+                unsigned int stripeCount = (desc.height + stripeRows - 1)/stripeRows;
+                unsigned int indexSize = QOI_STRIPES_HEADER_SIZE + (stripeCount + 1)*sizeof(unsigned int);
+                ImageStripes stripes = { .pixels = (unsigned char *)data + propsSize, .width = desc.width, .height = desc.height, .channels = desc.channels, .stripeRows = stripeRows };
+                stripes.stripes = (unsigned char **)RL_CALLOC(stripeCount, sizeof(unsigned char *));
+                stripes.stripeSizes = (unsigned int *)RL_CALLOC(stripeCount, sizeof(unsigned int));
+
+                if ((stripes.stripes != NULL) && (stripes.stripeSizes != NULL))
+                {
+                    if ((size - propsSize) >= 2*RRES_PARALLEL_SEGMENT_SIZE) RunParallelJobs(EncodeStripeQOI, &stripes, stripeCount);
+                    else for (unsigned int i = 0; i < stripeCount; i++) EncodeStripeQOI(&stripes, i);
+
+                    bool encoded = true;
+                    unsigned long long stripesSize = 0;
+
+                    for (unsigned int i = 0; i < stripeCount; i++)
+                    {
+                        if (stripes.stripes[i] == NULL) encoded = false;
+                        stripesSize += stripes.stripeSizes[i];
+                    }
+
+                    if (encoded && ((indexSize + stripesSize) < 0xffffffff)) compData = (unsigned char *)RL_MALLOC(indexSize + (size_t)stripesSize);
+
+                    if (compData != NULL)
+                    {
+                        unsigned int header[5] = { desc.width, desc.height, desc.channels, stripeRows, stripeCount };
+                        unsigned int offset = 0;
+
+                        memcpy(compData, "qois", 4);
+                        memcpy(compData + 4, header, sizeof(header));
+
+                        for (unsigned int i = 0; i < stripeCount; i++)
+                        {
+                            memcpy(compData + QOI_STRIPES_HEADER_SIZE + i*sizeof(unsigned int), &offset, sizeof(unsigned int));
+                            memcpy(compData + indexSize + offset, stripes.stripes[i], stripes.stripeSizes[i]);
+                            offset += stripes.stripeSizes[i];
+                        }
+
+                        memcpy(compData + QOI_STRIPES_HEADER_SIZE + stripeCount*sizeof(unsigned int), &offset, sizeof(unsigned int));
+                        *compSize = indexSize + offset;
+                    }
+                }
+
+                if (stripes.stripes != NULL) for (unsigned int i = 0; i < stripeCount; i++) RL_FREE(stripes.stripes[i]);
+                RL_FREE(stripes.stripes);
+                RL_FREE(stripes.stripeSizes);
+            }
+        }
+    }
+
+    return compData;
+}
+
+// Compression codec: QOI, decompress image into output
+// NOTE: QOI data only contains image pixels, image properties (propCount + props[4]) are reconstructed from QOI header:
+// width, height, pixel format (channels) and mipmaps, pixels are decoded directly into output
+static bool DecompressDataQOI(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned char *output, unsigned int outputSize)
+{
+    (void)dictionary; (void)dictionarySize;     // Dictionary not supported
+
+    bool success = false;
+    unsigned int width = 0, height = 0, channels = 0;
+
+    if (LoadQOIHeader(data, size, &width, &height, &channels) && (((unsigned long long)width*height*channels + 5*sizeof(unsigned int)) == outputSize))
+    {
+        unsigned int props[5] = { 4, width, height, (channels == 4)? RRES_PIXELFORMAT_UNCOMP_R8G8B8A8 : RRES_PIXELFORMAT_UNCOMP_R8G8B8, 1 };
+
+        memcpy(output, props, sizeof(props));
+        success = DecodeImageQOI(data, size, output + sizeof(props), outputSize - sizeof(props));
+    }
+
+    return success;
+}
+
+// Load QOI image header: width, height and channels
+// NOTE: QOI header: magic "qoif" + width + height (big-endian) + channels + colorspace,
+// QOI stripes header: magic "qois" + width + height + channels + stripeRows + stripeCount
+static bool LoadQOIHeader(const unsigned char *data, unsigned int size, unsigned int *width, unsigned int *height, unsigned int *channels)
+{
+    if ((data != NULL) && (size >= QOI_STRIPES_HEADER_SIZE) && (memcmp(data, "qois", 4) == 0))
+    {
+        memcpy(width, data + 4, sizeof(unsigned int));
+        memcpy(height, data + 8, sizeof(unsigned int));
+        memcpy(channels, data + 12, sizeof(unsigned int));
+    }
+    else if ((data != NULL) && (size >= (QOI_DATA_HEADER_SIZE + QOI_DATA_PADDING_SIZE)) && (memcmp(data, "qoif", 4) == 0))
+    {
+        *width = ((unsigned int)data[4] << 24) | ((unsigned int)data[5] << 16) | ((unsigned int)data[6] << 8) | data[7];
+        *height = ((unsigned int)data[8] << 24) | ((unsigned int)data[9] << 16) | ((unsigned int)data[10] << 8) | data[11];
+        *channels = data[12];
+    }
+    else return false;
+
+    return (*width > 0) && (*height > 0) && (*height < (QOI_DATA_PIXELS_MAX / *width)) && ((*channels == 3) || (*channels == 4));
+}
+
+// Decode QOI image pixels into provided buffer, pixels size must match image size (channels from header)
+// NOTE: Image stripes are decoded in parallel (if possible), directly into their rows in pixels buffer
+static bool DecodeImageQOI(const unsigned char *data, unsigned int size, unsigned char *pixels, unsigned int pixelsSize)
+{
+    unsigned int width = 0, height = 0, channels = 0;
+
+    if (!LoadQOIHeader(data, size, &width, &height, &channels) || (((unsigned long long)width*height*channels) != pixelsSize)) return false;
+    if (memcmp(data, "qois", 4) != 0) return DecodePixelsQOI(data, size, pixels, pixelsSize);
+
+    // Stripes index: stripeRows + stripeCount + offsets[stripeCount + 1]
+    unsigned int stripeRows = 0, stripeCount = 0;
+    memcpy(&stripeRows, data + 16, sizeof(unsigned int));
+    memcpy(&stripeCount, data + 20, sizeof(unsigned int));
+
+    if ((stripeRows == 0) || (stripeCount != ((height - 1)/stripeRows + 1))) return false;
+
+    unsigned long long indexSize = QOI_STRIPES_HEADER_SIZE + ((unsigned long long)stripeCount + 1)*sizeof(unsigned int);
+    if (indexSize > size) return false;
+
+    // NOTE: Offsets copied to keep them aligned, compressed data could not be aligned
+    unsigned int *offsets = (unsigned int *)RL_MALLOC((stripeCount + 1)*sizeof(unsigned int));
+    if (offsets == NULL) return false;
+    memcpy(offsets, data + QOI_STRIPES_HEADER_SIZE, (stripeCount + 1)*sizeof(unsigned int));
+
+    bool success = (offsets[stripeCount] <= (size - indexSize));
+
+    // Stripes offsets must be sorted, every stripe data is inside provided data
+    for (unsigned int i = 0; success && (i < stripeCount); i++) if (offsets[i + 1] < offsets[i]) success = false;
+
+    if (success)
+    {
+        ImageStripes stripes = { .data = data + indexSize, .offsets = offsets, .pixels = pixels, .width = width, .height = height, .channels = channels, .stripeRows = stripeRows };
+        stripes.results = (int *)RL_CALLOC(stripeCount, sizeof(int));
+
+        if (stripes.results != NULL)
+        {
+            if (pixelsSize >= 2*RRES_PARALLEL_SEGMENT_SIZE) RunParallelJobs(DecodeStripeQOI, &stripes, stripeCount);
+            else for (unsigned int i = 0; i < stripeCount; i++) DecodeStripeQOI(&stripes, i);
+
+            for (unsigned int i = 0; i < stripeCount; i++) if (stripes.results[i] != 0) success = false;
+        }
+        else success = false;
+
+        RL_FREE(stripes.results);
+    }
+
+    RL_FREE(offsets);
+
+    return success;
+}
+
+// Decode QOI image pixels, one stream
+// NOTE: Unlike qoi_decode(), no buffer is allocated, pixels are written directly into the final buffer
+static bool DecodePixelsQOI(const unsigned char *data, unsigned int size, unsigned char *pixels, unsigned int pixelsSize)
+{
+    unsigned int width = 0, height = 0, channels = 0;
+
+    if (!LoadQOIHeader(data, size, &width, &height, &channels) || (memcmp(data, "qoif", 4) != 0) || (((unsigned long long)width*height*channels) != pixelsSize)) return false;
+
+    // NOTE: Current pixel kept in local variables (not aliased by output writes), index stores packed RGBA values
+    unsigned int index[64] = { 0 };         // Previously seen pixels, by color hash
+    unsigned char r = 0, g = 0, b = 0, a = 255;
+    unsigned int count = width*height;
+    unsigned int p = QOI_DATA_HEADER_SIZE;
+    unsigned int end = size - QOI_DATA_PADDING_SIZE;   // NOTE: Padding follows chunks data, multi-byte chunks can be read safely
+    unsigned char *output = pixels;
+
+    for (unsigned int i = 0; i < count; )
+    {
+        if (p >= end) return false;         // Not enough data for image pixels
+
+        unsigned int run = 1;
+        unsigned int tag = data[p++];
+
+        if (tag == QOI_TAG_RGB)
+        {
+            r = data[p];
+            g = data[p + 1];
+            b = data[p + 2];
+            p += 3;
+        }
+        else if (tag == QOI_TAG_RGBA)
+        {
+            r = data[p];
+            g = data[p + 1];
+            b = data[p + 2];
+            a = data[p + 3];
+            p += 4;
+        }
+        else
+        {
+            switch (tag & QOI_TAG_MASK)
+            {
+                case QOI_TAG_INDEX:
+                {
+                    unsigned int value = index[tag];
+                    r = (unsigned char)value;
+                    g = (unsigned char)(value >> 8);
+                    b = (unsigned char)(value >> 16);
+                    a = (unsigned char)(value >> 24);
+                } break;
+                case QOI_TAG_DIFF:
+                {
+                    r += (unsigned char)(((tag >> 4) & 0x03) - 2);
+                    g += (unsigned char)(((tag >> 2) & 0x03) - 2);
+                    b += (unsigned char)((tag & 0x03) - 2);
+                } break;
+                case QOI_TAG_LUMA:
+                {
+                    unsigned int diff = data[p++];
+                    int vg = (int)(tag & 0x3f) - 32;
+                    r += (unsigned char)(vg - 8 + (int)((diff >> 4) & 0x0f));
+                    g += (unsigned char)vg;
+                    b += (unsigned char)(vg - 8 + (int)(diff & 0x0f));
+                } break;
+                default: run = (tag & 0x3f) + 1; break;     // QOI_TAG_RUN
+            }
+        }
+
+        index[(r*3 + g*5 + b*7 + a*11)%64] = r | ((unsigned int)g << 8) | ((unsigned int)b << 16) | ((unsigned int)a << 24);
+
+        if (run > (count - i)) run = count - i;
+        i += run;
+
+        if (channels == 4)
+        {
+            for (; run > 0; run--, output += 4) { output[0] = r; output[1] = g; output[2] = b; output[3] = a; }
+        }
+        else
+        {
+            for (; run > 0; run--, output += 3) { output[0] = r; output[1] = g; output[2] = b; }
+        }
+    }
+
+    return true;
+}
+
+// Parallel job: Encode one QOI image stripe
+static void EncodeStripeQOI(void *data, unsigned int index)
+{
+    ImageStripes *stripes = (ImageStripes *)data;
+    unsigned int row = index*stripes->stripeRows;
+
+    qoi_desc desc = { 0 };
+    desc.width = stripes->width;
+    desc.height = ((stripes->height - row) < stripes->stripeRows)? (stripes->height - row) : stripes->stripeRows;
+    desc.channels = (unsigned char)stripes->channels;
+    desc.colorspace = QOI_SRGB;
+
+    int qoiSize = 0;
+    stripes->stripes[index] = (unsigned char *)qoi_encode(stripes->pixels + (size_t)row*stripes->width*stripes->channels, &desc, &qoiSize);
+    stripes->stripeSizes[index] = (qoiSize > 0)? (unsigned int)qoiSize : 0;
+}
+
+// Parallel job: Decode one QOI image stripe
+// NOTE: Stripe QOI header must match image width, channels and stripe rows
+static void DecodeStripeQOI(void *data, unsigned int index)
+{
+    ImageStripes *stripes = (ImageStripes *)data;
+    unsigned int row = index*stripes->stripeRows;
+    unsigned int rows = ((stripes->height - row) < stripes->stripeRows)? (stripes->height - row) : stripes->stripeRows;
+    const unsigned char *stripeData = stripes->data + stripes->offsets[index];
+    unsigned int stripeSize = stripes->offsets[index + 1] - stripes->offsets[index];
+    unsigned int width = 0, height = 0, channels = 0;
+    int result = 1;
+
+    if (LoadQOIHeader(stripeData, stripeSize, &width, &height, &channels) && (width == stripes->width) && (height == rows) && (channels == stripes->channels))
+    {
+        size_t rowSize = (size_t)stripes->width*stripes->channels;
+        if (DecodePixelsQOI(stripeData, stripeSize, stripes->pixels + (size_t)row*rowSize, (unsigned int)(rows*rowSize))) result = 0;
+    }
+
+    stripes->results[index] = result;
+}
+
+// Compression codec: index data, compress vertex indices
+// NOTE: Data is unpacked index data (propCount + props[] + indices), only VRTX index chunks (USHORT/UINT) supported,
+// props are stored uncompressed, every index is stored as its difference with previous index (index format range),
+// zigzag encoded (small negative differences are small values) and stored with 7 bits per byte (high bit: more bytes)
+static unsigned char *CompressDataIndices(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned int *compSize)
+{
+    (void)dictionary; (void)dictionarySize;     // Dictionary not supported
+
+    unsigned char *compData = NULL;
+    unsigned int props[5] = { 0 };      // propCount + props[4]: indexCount, attribute, componentCount, format
+    *compSize = 0;
+
+    if (size >= sizeof(props)) memcpy(props, data, sizeof(props));
+
+    unsigned int indexSize = (props[4] == RRES_VERTEX_FORMAT_USHORT)? 2 : (props[4] == RRES_VERTEX_FORMAT_UINT)? 4 : 0;
+    unsigned long long propsSize = (1 + (unsigned long long)props[0])*sizeof(unsigned int);
+
+    if ((props[0] >= 4) && (props[2] == RRES_VERTEX_ATTRIBUTE_INDEX) && (props[3] == 1) && (indexSize > 0) &&
+        ((propsSize + (unsigned long long)props[1]*indexSize) == size))
+    {
+        // NOTE: Maximum encoded index size: 3 bytes (16-bit), 5 bytes (32-bit)
+        unsigned long long maxSize = propsSize + (unsigned long long)props[1]*((indexSize == 2)? 3 : 5);
+        unsigned int mask = (indexSize == 2)? 0xffff : 0xffffffff;
+
+        if (maxSize <= 0xffffffff) compData = (unsigned char *)RL_MALLOC((size_t)maxSize);
+
+        if (compData != NULL)
+        {
+            unsigned int offset = (unsigned int)propsSize;
+            unsigned int previous = 0;
+
+            memcpy(compData, data, offset);
+
+            for (unsigned int i = 0; i < props[1]; i++)
+            {
+                unsigned int index = 0;
+                memcpy(&index, data + propsSize + (size_t)i*indexSize, indexSize);
+
+                unsigned int delta = (index - previous) & mask;
+                unsigned int zigzag = ((delta & (mask ^ (mask >> 1))) != 0)? (((~delta & mask) << 1) | 1) : (delta << 1);
+
+                while (zigzag >= 0x80)
+                {
+                    compData[offset++] = (unsigned char)(zigzag | 0x80);
+                    zigzag >>= 7;
+                }
+
+                compData[offset++] = (unsigned char)zigzag;
+                previous = index;
+            }
+
+            *compSize = offset;
+        }
+    }
+
+    return compData;
+}
+
+// Compression codec: index data, decompress vertex indices into output
+// NOTE: Indices are restored adding the decoded difference to previous index, encoded data must be fully consumed
+static bool DecompressDataIndices(const unsigned char *data, unsigned int size, const unsigned char *dictionary, unsigned int dictionarySize, unsigned char *output, unsigned int outputSize)
+{
+    (void)dictionary; (void)dictionarySize;     // Dictionary not supported
+
+    unsigned int props[5] = { 0 };      // propCount + props[4]: indexCount, attribute, componentCount, format
+
+    if (size < sizeof(props)) return false;
+    memcpy(props, data, sizeof(props));
+
+    unsigned int indexSize = (props[4] == RRES_VERTEX_FORMAT_USHORT)? 2 : (props[4] == RRES_VERTEX_FORMAT_UINT)? 4 : 0;
+    unsigned long long propsSize = (1 + (unsigned long long)props[0])*sizeof(unsigned int);
+
+    if ((props[0] < 4) || (props[2] != RRES_VERTEX_ATTRIBUTE_INDEX) || (props[3] != 1) || (indexSize == 0) || (propsSize > size) ||
+        ((propsSize + (unsigned long long)props[1]*indexSize) != outputSize)) return false;
+
+    unsigned int mask = (indexSize == 2)? 0xffff : 0xffffffff;
+    unsigned int offset = (unsigned int)propsSize;
+    unsigned int previous = 0;
+
+    memcpy(output, data, offset);
+
+    for (unsigned int i = 0; i < props[1]; i++)
+    {
+        if (offset >= size) return false;
+
+        unsigned int zigzag = data[offset++];
+
+        if (zigzag >= 0x80)
+        {
+            zigzag &= 0x7f;
+
+            for (unsigned int shift = 7; ; shift += 7)
+            {
+                if ((offset >= size) || (shift > 28)) return false;
+
+                unsigned int byte = data[offset++];
+                if ((shift == 28) && ((byte & 0x7f) > 0x0f)) return false;     // Value over 32 bits
+
+                zigzag |= (byte & 0x7f) << shift;
+                if (byte < 0x80) break;
+            }
+        }
+
+        if ((zigzag >> 1) > (mask >> 1)) return false;     // Difference out of index format range
+
+        unsigned int delta = ((zigzag & 1) != 0)? (~(zigzag >> 1) & mask) : (zigzag >> 1);
+        unsigned int index = (previous + delta) & mask;
+
+        memcpy(output + propsSize + (size_t)i*indexSize, &index, indexSize);
+        previous = index;
+    }
+
+    return (offset == size);
+}
+
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+// Encryption cipher: AES, encrypt data
+// NOTE: Packed data: encrypted data + salt[16] + MD5[16]
+static unsigned char *EncryptDataAES(const unsigned char *data, unsigned int size, unsigned int *packedSize)
+{
+    *packedSize = size + 16 + 16;
+    unsigned char *packedData = (unsigned char *)RL_CALLOC(*packedSize, 1);
+    if (packedData == NULL) return NULL;
+
+    memcpy(packedData, data, size);
+
+    uint8_t key[32] = { 0 };                    // Encryption key
+    uint8_t *salt = packedData + size;          // Key stretching salt
+    if (!GetRandomBytes(salt, 16)) { RL_FREE(packedData); return NULL; }   // NOTE: Shared salt not used, key must be unique per chunk
+    DeriveCipherKey(key, salt);
+
+    // MD5 of unencrypted data is used to verify decryption, computed in the same pass
+    struct AES_ctx ctx = { 0 };
+    AES_init_ctx(&ctx, key);
+    ProcessAES_CTR_MD5(&ctx, packedData, size, false, packedData + size + 16);   // AES Counter mode, stream cipher
+
+    crypto_wipe(key, 32);
+    crypto_wipe(&ctx, sizeof(struct AES_ctx));
+
+    return packedData;
+}
+
+// Encryption cipher: AES, decrypt data in place
+// WARNING: Implementation dependant!
+// rrespacker tool appends (salt[16] + MD5[16]) to encrypted data for convenience,
+// Actually, chunk->info.packedSize considers those additional elements
+static bool DecryptDataAES(unsigned char *data, unsigned int size, unsigned int *dataSize)
+{
+    if (size < (16 + 16)) return false;
+
+    // Required variables for key stretching
+    uint8_t key[32] = { 0 };                    // Encryption key
+    uint8_t salt[16] = { 0 };                   // Key stretching salt
+
+    // Retrieve salt from chunk packed data
+    // salt is stored at the end of packed data, before MD5: salt[16] + MD5[16]
+    memcpy(salt, data + (size - 16 - 16), 16);
+
+    // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
+    DeriveCipherKey(key, salt);
+
+    // Wipe key generation secrets, they are no longer needed
+    crypto_wipe(salt, 16);
+
+    // Required variables for decryption and message authentication
+    unsigned int md5[4] = { 0 };                // Message Authentication Code generated on encryption
+
+    // Retrieve MD5 from chunk packed data
+    // NOTE: MD5 is stored at the end of packed data, after salt: salt[16] + MD5[16]
+    memcpy(md5, data + (size - 16), 4*sizeof(unsigned int));
+
+    // Message decryption, requires key
+    // NOTE: MD5 of decrypted data is computed in the same pass, to check if data decryption worked
+    RRES_STATS_BEGIN(decryptTimer);
+    struct AES_ctx ctx = { 0 };
+    AES_init_ctx(&ctx, key);
+
+    unsigned int decryptMD5[4] = { 0 };
+    ProcessAES_CTR_MD5(&ctx, data, size - 16 - 16, true, (unsigned char *)decryptMD5);   // AES Counter mode, stream cipher
+
+    bool success = (memcmp(decryptMD5, md5, 4*sizeof(unsigned int)) == 0);
+
+    // Decryption failed, restore packed data (CTR mode is symmetric) so decryption can be retried
+    if (!success) ProcessAES_CTR(&ctx, data, size - 16 - 16, 0);
+    RRES_STATS_END(RRES_STATS_EVENT_DECRYPT, RRES_CIPHER_AES, decryptTimer);
+
+    // Wipe secrets if they are no longer needed
+    crypto_wipe(key, 32);
+    crypto_wipe(&ctx, sizeof(struct AES_ctx));
+
+    *dataSize = size - 16 - 16;     // We remove additional data size (salt[16] + MD5[16])
+
+    return success;
+}
+#endif
+
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+// Encryption cipher: XChaCha20-Poly1305, encrypt data
+// NOTE: Packed data: encrypted data + salt[16] + nonce[24] + MAC[16]
+static unsigned char *EncryptDataXChaCha20(const unsigned char *data, unsigned int size, unsigned int *packedSize)
+{
+    *packedSize = size + 16 + 24 + 16;
+    unsigned char *packedData = (unsigned char *)RL_CALLOC(*packedSize, 1);
+    if (packedData == NULL) return NULL;
+
+    uint8_t key[32] = { 0 };                    // Encryption key
+    uint8_t *salt = packedData + size;          // Key stretching salt
+    uint8_t *nonce = salt + 16;                 // nonce, unique to processed data
+    uint8_t *mac = nonce + 24;                  // Message Authentication Code
+    if (cipherSaltShared) memcpy(salt, cipherSalt, 16);
+    else if (!GetRandomBytes(salt, 16)) { RL_FREE(packedData); return NULL; }
+    if (!GetRandomBytes(nonce, 24)) { RL_FREE(packedData); return NULL; }
+    DeriveCipherKey(key, salt);
+
+    crypto_aead_lock(packedData, mac, key, nonce, NULL, 0, data, size);
+
+    crypto_wipe(key, 32);
+
+    return packedData;
+}
+
+// Encryption cipher: XChaCha20-Poly1305, decrypt data in place
+// WARNING: Implementation dependant!
+// rrespacker tool appends (salt[16] + nonce[24] + MAC[16]) to encrypted data for convenience,
+// Actually, chunk->info.packedSize considers those additional elements
+static bool DecryptDataXChaCha20(unsigned char *data, unsigned int size, unsigned int *dataSize)
+{
+    if (size < (16 + 24 + 16)) return false;
+
+    // Required variables for key stretching
+    uint8_t key[32] = { 0 };                    // Encryption key
+    uint8_t salt[16] = { 0 };                   // Key stretching salt
+
+    // Retrieve salt from chunk packed data
+    // salt is stored at the end of packed data, before nonce and MAC: salt[16] + nonce[24] + MAC[16]
+    memcpy(salt, data + (size - 16 - 24 - 16), 16);
+
+    // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
+    DeriveCipherKey(key, salt);
+
+    // Wipe key generation secrets, they are no longer needed
+    crypto_wipe(salt, 16);
+
+    // Required variables for decryption and message authentication
+    uint8_t nonce[24] = { 0 };                  // nonce used on encryption, unique to processed file
+    uint8_t mac[16] = { 0 };                    // Message Authentication Code generated on encryption
+
+    // Retrieve nonce and MAC from chunk packed data
+    // nonce and MAC are stored at the end of packed data, after salt: salt[16] + nonce[24] + MAC[16]
+    memcpy(nonce, data + (size - 16 - 24), 24);
+    memcpy(mac, data + (size - 16), 16);
+
+    // Message decryption requires key, nonce and MAC
+    // NOTE: MAC is verified before decryption, data is not modified if verification fails
+    RRES_STATS_BEGIN(decryptTimer);
+    int decryptResult = DecryptXChaCha20Poly1305(data, (size - 16 - 24 - 16), key, nonce, mac);
+    RRES_STATS_END(RRES_STATS_EVENT_DECRYPT, RRES_CIPHER_XCHACHA20_POLY1305, decryptTimer);
+
+    // Wipe secrets if they are no longer needed
+    crypto_wipe(nonce, 24);
+    crypto_wipe(key, 32);
+
+    *dataSize = size - 16 - 24 - 16;    // We remove additional data size (salt[16] + nonce[24] + MAC[16])
+
+    return (decryptResult == 0);
+}
+
+// Encryption cipher: XChaCha20-Poly1305 segmented, encrypt data
+// NOTE: Packed data: encrypted segments + MAC[16]*segmentCount + salt[16] + nonce[24] + segmentSize + dataSize,
+// encrypted segments keep data size, segment position in packed data is: index*segmentSize
+static unsigned char *EncryptDataXChaCha20Segments(const unsigned char *data, unsigned int size, unsigned int *packedSize)
+{
+    AEADSegments segments = { 0 };
+    segments.dataSize = size;
+    segments.segmentSize = RRES_CIPHER_SEGMENT_SIZE;
+    segments.segmentCount = (segments.dataSize + segments.segmentSize - 1)/segments.segmentSize;
+
+    *packedSize = segments.dataSize + segments.segmentCount*16 + CIPHER_SEGMENTS_FOOTER_SIZE;
+    unsigned char *packedData = (unsigned char *)RL_CALLOC(*packedSize, 1);
+    if (packedData == NULL) return NULL;
+
+    memcpy(packedData, data, size);
+
+    uint8_t key[32] = { 0 };                    // Encryption key
+    uint8_t *salt = packedData + segments.dataSize + segments.segmentCount*16;  // Key stretching salt
+    uint8_t *nonce = salt + 16;                 // Base nonce, unique to processed data
+    if (cipherSaltShared) memcpy(salt, cipherSalt, 16);
+    else if (!GetRandomBytes(salt, 16)) { RL_FREE(packedData); return NULL; }
+    if (!GetRandomBytes(nonce, 24)) { RL_FREE(packedData); return NULL; }
+    memcpy(nonce + 24, &segments.segmentSize, sizeof(unsigned int));
+    memcpy(nonce + 24 + 4, &segments.dataSize, sizeof(unsigned int));
+    DeriveCipherKey(key, salt);
+
+    segments.data = packedData;
+    segments.macs = packedData + segments.dataSize;
+    segments.key = key;
+    memcpy(segments.nonce, nonce, 24);
+
+    ProcessAEADSegments(&segments, segments.segmentCount, false);
+
+    crypto_wipe(key, 32);
+
+    return packedData;
+}
+
+// Encryption cipher: XChaCha20-Poly1305 segmented, decrypt data in place
+// WARNING: Implementation dependant!
+// Data is encrypted by segments, every segment MAC and the segments layout are appended to encrypted data:
+// MAC[16]*segmentCount + salt[16] + nonce[24] + segmentSize + dataSize
+static bool DecryptDataXChaCha20Segments(unsigned char *data, unsigned int size, unsigned int *dataSize)
+{
+    AEADSegments segments = { 0 };
+    uint8_t key[32] = { 0 };                    // Encryption key
+    uint8_t salt[16] = { 0 };                   // Key stretching salt
+    int decryptResult = -1;
+
+    if ((size >= CIPHER_SEGMENTS_FOOTER_SIZE) && LoadAEADSegmentsFooter(&segments, salt, data + (size - CIPHER_SEGMENTS_FOOTER_SIZE), size))
+    {
+        // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
+        DeriveCipherKey(key, salt);
+        crypto_wipe(salt, 16);
+
+        segments.data = data;
+        segments.macs = data + segments.dataSize;
+        segments.key = key;
+
+        // NOTE: All segments MAC are verified, data is not modified if any segment verification fails
+        RRES_STATS_BEGIN(decryptTimer);
+        decryptResult = ProcessAEADSegments(&segments, segments.segmentCount, true);
+        RRES_STATS_END(RRES_STATS_EVENT_DECRYPT, RRES_CIPHER_XCHACHA20_POLY1305_SEGMENTED, decryptTimer);
+
+        // Wipe secrets if they are no longer needed
+        crypto_wipe(segments.nonce, 24);
+        crypto_wipe(key, 32);
+    }
+
+    *dataSize = segments.dataSize;      // We remove additional data size (segments MAC and footer)
+
+    return (decryptResult == 0);
+}
+
+// Encryption cipher: XChaCha20-Poly1305 segmented, load decrypted data range from file
+// NOTE: Range is relative to decrypted data, the segments covering the range are read and verified
+static bool LoadDecryptedRangeXChaCha20Segments(const char *fileName, rresResourceChunkInfo info, unsigned int offset, unsigned int size, unsigned char *buffer)
+{
+    bool success = false;
+    unsigned char footer[CIPHER_SEGMENTS_FOOTER_SIZE] = { 0 };
+    AEADSegments segments = { 0 };
+    uint8_t key[32] = { 0 };                    // Encryption key
+    uint8_t salt[16] = { 0 };                   // Key stretching salt
+
+    if ((info.packedSize < CIPHER_SEGMENTS_FOOTER_SIZE) ||
+        (rresReadResourceChunkRange(fileName, info.id, info.packedSize - CIPHER_SEGMENTS_FOOTER_SIZE, CIPHER_SEGMENTS_FOOTER_SIZE, footer) != CIPHER_SEGMENTS_FOOTER_SIZE) ||
+        !LoadAEADSegmentsFooter(&segments, salt, footer, info.packedSize) ||
+        (size == 0) || (((unsigned long long)offset + size) > segments.dataSize))
+    {
+        crypto_wipe(salt, 16);
+        crypto_wipe(segments.nonce, 24);
+        return false;
+    }
+
+    // Segments covering the requested range: [first, last]
+    unsigned int first = offset/segments.segmentSize;
+    unsigned int last = (offset + size - 1)/segments.segmentSize;
+    unsigned int count = last - first + 1;
+    unsigned int rangeOffset = first*segments.segmentSize;
+    unsigned int rangeSize = (((unsigned long long)last + 1)*segments.segmentSize > segments.dataSize)? (segments.dataSize - rangeOffset) : (count*segments.segmentSize);
+
+    // Segments data and MACs are read into the same buffer: data + MAC[16]*count
+    unsigned char *rangeData = (unsigned char *)RL_MALLOC(rangeSize + count*16);
+
+    if ((rangeData != NULL) &&
+        (rresReadResourceChunkRange(fileName, info.id, rangeOffset, rangeSize, rangeData) == rangeSize) &&
+        (rresReadResourceChunkRange(fileName, info.id, segments.dataSize + first*16, count*16, rangeData + rangeSize) == count*16))
+    {
+        RRES_TRACE_BEGIN(decryptSpan);
+        DeriveCipherKey(key, salt);
+
+        segments.data = rangeData;
+        segments.macs = rangeData + rangeSize;
+        segments.key = key;
+        segments.first = first;
+
+        RRES_STATS_BEGIN(decryptTimer);
+        if (ProcessAEADSegments(&segments, count, true) == 0)
+        {
+            memcpy(buffer, rangeData + (offset - rangeOffset), size);
+            success = true;
+        }
+        RRES_STATS_END(RRES_STATS_EVENT_DECRYPT, RRES_CIPHER_XCHACHA20_POLY1305_SEGMENTED, decryptTimer);
+        RRES_TRACE_END(RRES_TRACE_DECRYPT, info.id, info.type, decryptSpan);
+
+        if (!success) RRES_LOG("RRES: WARNING: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", info.type[0], info.type[1], info.type[2], info.type[3]);
+
+        // Wipe secrets if they are no longer needed
+        crypto_wipe(key, 32);
+        crypto_wipe(rangeData, rangeSize);
+    }
+
+    crypto_wipe(salt, 16);
+    crypto_wipe(segments.nonce, 24);
+    RL_FREE(rangeData);
+
+    return success;
+}
+#endif
+
+// Load chunk data range from file, decrypted (if required)
+// NOTE: Range is relative to decrypted data, only ciphers providing decryptRange() support random access to encrypted data
+static bool LoadDecryptedDataRange(const char *fileName, rresResourceChunkInfo info, unsigned int offset, unsigned int size, unsigned char *buffer)
+{
+    if (info.cipherType == RRES_CIPHER_NONE) return (rresReadResourceChunkRange(fileName, info.id, offset, size, buffer) == size);
+
+    const EncryptionCipher *cipher = GetEncryptionCipher(info.cipherType);
+
+    if ((cipher != NULL) && (cipher->decryptRange != NULL)) return cipher->decryptRange(fileName, info, offset, size, buffer);
+
+    RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data encryption algorithm does not support random access\n", info.type[0], info.type[1], info.type[2], info.type[3]);
+
+    return false;
+}
+
+// Load chunk data range from file, decrypted and decompressed (if required)
+// NOTE: Range is relative to unpacked data, data compressed in blocks reads the blocks index first,
+// then only the blocks covering the range are read and decompressed
+static bool LoadUnpackedDataRange(const char *fileName, rresResourceChunkInfo info, unsigned int offset, unsigned int size, unsigned char *buffer)
+{
+    if (info.compType == RRES_COMP_NONE) return LoadDecryptedDataRange(fileName, info, offset, size, buffer);
+
+    bool success = false;
+    unsigned int header[2] = { 0 };     // Blocks index header: blockSize, blockCount
+
+    if (((info.flags & RRES_FLAG_COMP_BLOCKS) == 0) || (size == 0) || (((unsigned long long)offset + size) > info.baseSize) ||
+        !LoadDecryptedDataRange(fileName, info, 0, 2*sizeof(unsigned int), (unsigned char *)header) ||
+        (header[0] == 0) || (header[1] != ((unsigned long long)info.baseSize + header[0] - 1)/header[0])) return false;
+
+    unsigned int blockSize = header[0];
+    unsigned int blockCount = header[1];
+    unsigned int indexSize = (2 + blockCount + 1)*sizeof(unsigned int);
+
+    // Blocks covering the requested range: [first, last]
+    unsigned int first = offset/blockSize;
+    unsigned int last = (offset + size - 1)/blockSize;
+    unsigned int count = last - first + 1;
+    unsigned int rangeOffset = first*blockSize;
+    unsigned int rangeSize = (((unsigned long long)last + 1)*blockSize > info.baseSize)? (info.baseSize - rangeOffset) : (count*blockSize);
+
+    unsigned int *offsets = (unsigned int *)RL_MALLOC((count + 1)*sizeof(unsigned int));
+
+    if ((offsets != NULL) && LoadDecryptedDataRange(fileName, info, (2 + first)*sizeof(unsigned int), (count + 1)*sizeof(unsigned int), (unsigned char *)offsets) &&
+        (offsets[count] >= offsets[0]))
+    {
+        unsigned int compSize = offsets[count] - offsets[0];
+        unsigned char *compData = (unsigned char *)RL_MALLOC((compSize > 0)? compSize : 1);
+        unsigned char *rangeData = (unsigned char *)RL_MALLOC(rangeSize);
+
+        if ((compData != NULL) && (rangeData != NULL) && LoadDecryptedDataRange(fileName, info, indexSize + offsets[0], compSize, compData))
+        {
+            DataBlocks blocks = { .data = compData, .offsets = offsets, .output = rangeData, .codec = GetCompressionCodec(info.compType), .blockSize = blockSize, .dataSize = info.baseSize, .first = first };
+
+            RRES_STATS_BEGIN(decompTimer);
+            RRES_TRACE_BEGIN(decompSpan);
+            if (ProcessDataBlocks(&blocks, count))
+            {
+                memcpy(buffer, rangeData + (offset - rangeOffset), size);
+                success = true;
+            }
+            RRES_TRACE_END(RRES_TRACE_DECOMPRESS, info.id, info.type, decompSpan);
+            RRES_STATS_END(RRES_STATS_EVENT_DECOMPRESS, info.compType, decompTimer);
+        }
+
+        RL_FREE(rangeData);
+        RL_FREE(compData);
+    }
+
+    if (!success) RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data blocks decompression failed\n", info.type[0], info.type[1], info.type[2], info.type[3]);
+
+    RL_FREE(offsets);
+
+    return success;
+}
+
+// Load chunk data to be packed, as stored in rres file: propCount + props[] + raw
+// NOTE: Requested data filters (if valid) are applied to raw data, NULL returned if chunk sizes
+// are not valid (baseSize smaller than props size) or memory allocation fails
+static unsigned char *LoadPackingData(const rresResourceChunk *chunk)
+{
+    unsigned long long propsSize = (1 + (unsigned long long)chunk->data.propCount)*sizeof(unsigned int);
+
+    if ((propsSize > chunk->info.baseSize) || ((chunk->data.propCount > 0) && (chunk->data.props == NULL)))
+    {
+        RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data size not valid\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        return NULL;
+    }
+
+    unsigned int rawSize = chunk->info.baseSize - (unsigned int)propsSize;
+    unsigned char *data = (unsigned char *)RL_MALLOC((chunk->info.baseSize > 0)? chunk->info.baseSize : 1);
+
+    if (data != NULL)
+    {
+        memcpy(data, &chunk->data.propCount, sizeof(unsigned int));
+        if (chunk->data.propCount > 0) memcpy(data + sizeof(unsigned int), chunk->data.props, chunk->data.propCount*sizeof(unsigned int));
+        memcpy(data + propsSize, chunk->data.raw, rawSize);
+
+        if (((chunk->info.flags & FILTER_FLAGS) != 0) && IsDataFilterValid(chunk->info.flags)) FilterData(data + propsSize, rawSize, chunk->info.flags);
+    }
+    else RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data could not be allocated for packing\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+
+    return data;
+}
+
+// Compress data in independent blocks, blocks index stored before blocks data
+// NOTE: Packed data: blockSize + blockCount + offsets[blockCount + 1] + blocks data, offsets relative to blocks data start,
+// blocks not reduced by compression are stored uncompressed (block packed size equals block size)
+static unsigned char *CompressDataBlocks(const unsigned char *data, unsigned int size, const CompressionCodec *codec, unsigned int blockSize, unsigned int *compDataSize)
+{
+    unsigned int blockCount = (unsigned int)(((unsigned long long)size + blockSize - 1)/blockSize);
+    unsigned int indexSize = (2 + blockCount + 1)*sizeof(unsigned int);
+
+    // NOTE: Worst case allocated, all blocks stored uncompressed
+    unsigned char *compData = (unsigned char *)RL_MALLOC(indexSize + size);
+    if (compData == NULL) return NULL;
+
+    unsigned int *index = (unsigned int *)compData;
+    unsigned int *offsets = index + 2;
+    index[0] = blockSize;
+    index[1] = blockCount;
+    offsets[0] = 0;
+
+    for (unsigned int i = 0; i < blockCount; i++)
+    {
+        const unsigned char *block = data + (size_t)i*blockSize;
+        unsigned int blockDataSize = ((size - i*blockSize) < blockSize)? (size - i*blockSize) : blockSize;
+        unsigned char *blockCompData = compData + indexSize + offsets[i];
+        unsigned int blockCompSize = 0;
+        unsigned char *blockPackedData = codec->compress(block, blockDataSize, NULL, 0, &blockCompSize);
+
+        if ((blockPackedData != NULL) && (blockCompSize > 0) && (blockCompSize < blockDataSize)) memcpy(blockCompData, blockPackedData, blockCompSize);
+        else blockCompSize = 0;
+
+        RL_FREE(blockPackedData);
+
+        // Block not reduced by compression, stored uncompressed
+        if (blockCompSize == 0)
+        {
+            memcpy(blockCompData, block, blockDataSize);
+            blockCompSize = blockDataSize;
+        }
+
+        offsets[i + 1] = offsets[i] + blockCompSize;
+    }
+
+    *compDataSize = indexSize + offsets[blockCount];
+
+    return compData;
+}
+
+// Decompress data blocks into output, output size must match blocks data size
+static bool DecompressDataBlocks(const unsigned char *packedData, unsigned int packedSize, const CompressionCodec *codec, unsigned char *output, unsigned int outputSize)
+{
+    if (packedSize < 3*sizeof(unsigned int)) return false;
+
+    // Blocks index: blockSize + blockCount + offsets[blockCount + 1]
+    const unsigned int *index = (const unsigned int *)packedData;
+    unsigned int blockSize = index[0];
+    unsigned int blockCount = index[1];
+
+    if ((blockSize == 0) || (blockCount != ((unsigned long long)outputSize + blockSize - 1)/blockSize) ||
+        (((unsigned long long)blockCount + 3)*sizeof(unsigned int) > packedSize)) return false;
+
+    unsigned int indexSize = (2 + blockCount + 1)*sizeof(unsigned int);
+    const unsigned int *offsets = index + 2;
+
+    if ((offsets[0] != 0) || (offsets[blockCount] != (packedSize - indexSize))) return false;
+
+    DataBlocks blocks = { .data = packedData + indexSize, .offsets = offsets, .output = output, .codec = codec, .blockSize = blockSize, .dataSize = outputSize, .first = 0 };
+
+    return ProcessDataBlocks(&blocks, blockCount);
+}
+
+// Decompress data blocks, from blocks->first
+// NOTE: Large data is decompressed in parallel, every block is decompressed into its final position in output
+static bool ProcessDataBlocks(DataBlocks *blocks, unsigned int count)
+{
+    bool success = true;
+
+    // Blocks offsets must be sorted, every block data is inside provided compressed data
+    for (unsigned int i = 0; i < count; i++) if (blocks->offsets[i + 1] < blocks->offsets[i]) return false;
+
+    blocks->results = (int *)RL_CALLOC(count, sizeof(int));
+    if (blocks->results == NULL) return false;
+
+    // NOTE: Small data is always processed in calling thread, avoiding threads creation
+    if (((unsigned long long)count*blocks->blockSize) >= 2*RRES_PARALLEL_SEGMENT_SIZE) RunParallelJobs(DecompressDataBlock, blocks, count);
+    else for (unsigned int i = 0; i < count; i++) DecompressDataBlock(blocks, i);
+
+    for (unsigned int i = 0; i < count; i++) if (blocks->results[i] != 0) success = false;
+
+    RL_FREE(blocks->results);
+    blocks->results = NULL;
+
+    return success;
+}
+
+// Parallel job: Decompress one data block
+static void DecompressDataBlock(void *data, unsigned int index)
+{
+    DataBlocks *blocks = (DataBlocks *)data;
+    unsigned long long offset = ((unsigned long long)blocks->first + index)*blocks->blockSize;
+    unsigned int size = ((blocks->dataSize - offset) < blocks->blockSize)? (unsigned int)(blocks->dataSize - offset) : blocks->blockSize;
+    unsigned int compSize = blocks->offsets[index + 1] - blocks->offsets[index];
+    const unsigned char *compData = blocks->data + (blocks->offsets[index] - blocks->offsets[0]);
+    unsigned char *output = blocks->output + (size_t)index*blocks->blockSize;
+    int result = -1;
+
+    if (compSize == size)
+    {
+        // Block stored uncompressed
+        memcpy(output, compData, size);
+        result = 0;
+    }
+    else if (compSize < size)
+    {
+        if (blocks->codec->decompressInto != NULL)
+        {
+            if (blocks->codec->decompressInto(compData, compSize, NULL, 0, output, size)) result = 0;
+        }
+        else
+        {
+            unsigned int blockSize = 0;
+            unsigned char *blockData = blocks->codec->decompress(compData, compSize, &blockSize);
+
+            if ((blockData != NULL) && (blockSize == size))
+            {
+                memcpy(output, blockData, size);
+                result = 0;
+            }
+
+            RL_FREE(blockData);
+        }
+    }
+
+    blocks->results[index] = result;
+}
+
+// Add compression dictionary (if not loaded), returns dictionary index (-1 on failure)
+// NOTE: Dictionaries are identified by its data CRC32 hash, data is copied
+static int AddCompressionDictionary(const unsigned char *data, unsigned int size, const char *fileName)
+{
+    if ((size == 0) || (size > COMP_DICTIONARY_MAX_SIZE)) return -1;
+
+    unsigned int id = rresComputeCRC32(data, (int)size);
+    const CompressionDictionary *loaded = GetCompressionDictionary(id);
+
+    if (loaded != NULL) return (int)(loaded - compDictionaries);
+
+    if (compDictionaryCount >= COMP_DICTIONARIES_MAX)
+    {
+        RRES_LOG("RRES: WARNING: DICT: Compression dictionaries limit reached (%i)\n", COMP_DICTIONARIES_MAX);
+        return -1;
+    }
+
+    CompressionDictionary *dictionary = &compDictionaries[compDictionaryCount];
+    dictionary->data = (unsigned char *)RL_MALLOC(size);
+    if (dictionary->data == NULL) return -1;
+
+    memcpy(dictionary->data, data, size);
+    dictionary->id = id;
+    if (fileName != NULL) SetCompressionDictionaryFile(dictionary, fileName);
+    dictionary->size = size;
+    compDictionaryCount++;
+
+    RRES_LOG("RRES: DICT: Compression dictionary loaded: 0x%08x (%u bytes)\n", id, size);
+
+    return (int)(compDictionaryCount - 1);
+}
+
+// Set compression dictionary source file: fileId and fileName copy
+// NOTE: If file name can not be copied dictionary is kept as not loaded from file
+static void SetCompressionDictionaryFile(CompressionDictionary *dictionary, const char *fileName)
+{
+    dictionary->fileName = CopyFileName(fileName);
+    dictionary->fileId = (dictionary->fileName != NULL)? rresComputeCRC32((const unsigned char *)fileName, (int)strlen(fileName)) : 0;
+}
+
+// Get compression dictionary for provided id, NULL if not loaded
+static const CompressionDictionary *GetCompressionDictionary(unsigned int id)
+{
+    for (unsigned int i = 0; i < compDictionaryCount; i++)
+    {
+        if (compDictionaries[i].id == id) return &compDictionaries[i];
+    }
+
+    return NULL;
+}
+
+// Get hash table index for an 8-byte sequence (multiplicative hashing)
+static unsigned int HashDictionarySequence(const unsigned char *data)
+{
+    unsigned long long sequence = 0;
+    memcpy(&sequence, data, 8);
+
+    return (unsigned int)((sequence*0x9e3779b97f4a7c15ULL) >> 48)%COMP_DICTIONARY_HASH_SIZE;
+}
+
+// Get dictionary segment score: sum of samples count for every 8-byte sequence found in multiple samples
+static unsigned int ScoreDictionarySegment(const unsigned char *data, unsigned int size, const unsigned int *counts)
+{
+    unsigned int score = 0;
+
+    for (unsigned int i = 0; (i + 8) <= size; i++)
+    {
+        unsigned int count = counts[HashDictionarySequence(data + i)];
+        if (count > 1) score += count;
+    }
+
+    return score;
+}
+
+// Compare dictionary segments by score (descending), for qsort()
+static int CompareDictionarySegments(const void *a, const void *b)
+{
+    unsigned int scoreA = ((const DictionarySegment *)a)->score;
+    unsigned int scoreB = ((const DictionarySegment *)b)->score;
+
+    return (scoreA < scoreB) - (scoreA > scoreB);
+}
+
+// Check data filter flags are valid: one element filter at most (delta or XOR)
+static bool IsDataFilterValid(unsigned int flags)
+{
+    unsigned int filter = flags & FILTER_FLAGS;
+
+    if (filter == 0) return true;
+    if ((filter & (RRES_FLAG_FILTER_SHUFFLE | RRES_FLAG_FILTER_DELTA | RRES_FLAG_FILTER_XOR)) == 0) return false;
+    if (((filter & RRES_FLAG_FILTER_DELTA) != 0) && ((filter & RRES_FLAG_FILTER_XOR) != 0)) return false;
+
+    return true;
+}
+
+// Apply data filters in place: elements delta/XOR encoded, then element bytes shuffled by tiles
+// NOTE: Shuffled tile stores byte 0 of all tile elements, then byte 1... tile bytes not fitting an element are not modified,
+// tiles are FILTER_TILE_SIZE (multiple of 8) to be unshuffled in cache, on data decompression
+static void FilterData(unsigned char *data, unsigned int size, unsigned int flags)
+{
+    unsigned int elementSize = FILTER_ELEMENT_SIZE(flags);
+    unsigned int stride = FILTER_DISTANCE(flags)*elementSize;
+    unsigned char tile[FILTER_TILE_SIZE];   // Shuffle tile, same as UnfilterData(), no allocation required
+
+    if ((flags & (RRES_FLAG_FILTER_DELTA | RRES_FLAG_FILTER_XOR)) != 0)
+    {
+        // Elements processed backwards, previous element is still not filtered
+        // NOTE: Elements are little-endian integers (or float bits), arithmetic modulo element size
+        for (unsigned int i = (size/elementSize)*elementSize; i > stride; )
+        {
+            i -= elementSize;
+
+            unsigned long long value = 0;
+            unsigned long long previous = 0;
+            memcpy(&value, data + i, elementSize);
+            memcpy(&previous, data + i - stride, elementSize);
+
+            value = ((flags & RRES_FLAG_FILTER_XOR) != 0)? (value ^ previous) : (value - previous);
+            memcpy(data + i, &value, elementSize);
+        }
+    }
+
+    if (((flags & RRES_FLAG_FILTER_SHUFFLE) != 0) && (elementSize > 1))
+    {
+        for (unsigned int offset = 0; offset < size; offset += FILTER_TILE_SIZE)
+        {
+            unsigned int tileSize = ((size - offset) < FILTER_TILE_SIZE)? (size - offset) : FILTER_TILE_SIZE;
+            unsigned int count = tileSize/elementSize;
+
+            for (unsigned int i = 0; i < count; i++)
+            {
+                for (unsigned int j = 0; j < elementSize; j++) tile[j*count + i] = data[offset + i*elementSize + j];
+            }
+
+            memcpy(data + offset, tile, count*elementSize);
+        }
+    }
+}
+
+// Undo data filters, filtered data is restored into output
+// NOTE: Output can be the same buffer or a lower address (raw data moved to buffer start),
+// data is processed by tiles: element bytes unshuffled into a tile buffer, then elements restored in output
+static void UnfilterData(unsigned char *output, const unsigned char *data, unsigned int size, unsigned int flags)
+{
+    unsigned int elementSize = FILTER_ELEMENT_SIZE(flags);
+    unsigned int stride = FILTER_DISTANCE(flags)*elementSize;
+    bool shuffle = ((flags & RRES_FLAG_FILTER_SHUFFLE) != 0) && (elementSize > 1);
+    int mode = ((flags & RRES_FLAG_FILTER_XOR) != 0)? FILTER_MODE_XOR : ((flags & RRES_FLAG_FILTER_DELTA) != 0)? FILTER_MODE_ADD : FILTER_MODE_NONE;
+    unsigned char tile[FILTER_TILE_SIZE];
+
+#if defined(RRES_FILTER_SIMD_AVX2)
+    if (filterAVX2 < 0) filterAVX2 = IsAVX2Supported()? 1 : 0;
+#endif
+
+    for (unsigned int offset = 0; offset < size; offset += FILTER_TILE_SIZE)
+    {
+        unsigned int tileSize = ((size - offset) < FILTER_TILE_SIZE)? (size - offset) : FILTER_TILE_SIZE;
+
+        if (shuffle)
+        {
+            UnshuffleTile(tile, data + offset, tileSize, elementSize);
+            memcpy(output + offset, tile, tileSize);
+        }
+        else if (output != data) memmove(output + offset, data + offset, tileSize);
+
+        // NOTE: Tiles contain complete elements, trailing data bytes not fitting an element are not filtered
+        if (mode != FILTER_MODE_NONE) UndoElementsFilter(output, offset, offset + (tileSize/elementSize)*elementSize, elementSize, stride, mode);
+    }
+}
+
+// Unshuffle tile bytes: byte planes interleaved into elements
+static void UnshuffleTile(unsigned char *output, const unsigned char *tile, unsigned int size, unsigned int elementSize)
+{
+    unsigned int count = size/elementSize;
+    unsigned int i = 0;
+
+#if defined(RRES_FILTER_SIMD_AVX2)
+    if ((filterAVX2 == 1) && (elementSize <= 4)) i = UnshuffleTileAVX2(output, tile, count, elementSize);
+    else i = UnshuffleTileSSE2(output, tile, count, elementSize, 0);
+#elif defined(RRES_FILTER_SIMD_SSE2)
+    i = UnshuffleTileSSE2(output, tile, count, elementSize, 0);
+#elif defined(RRES_FILTER_SIMD_NEON)
+    i = UnshuffleTileNEON(output, tile, count, elementSize);
+#endif
+
+    // Remaining elements (not fitting SIMD registers)
+    for (; i < count; i++)
+    {
+        for (unsigned int j = 0; j < elementSize; j++) output[i*elementSize + j] = tile[j*count + i];
+    }
+
+    // Tile bytes not fitting an element are not shuffled
+    memcpy(output + count*elementSize, tile + count*elementSize, size - count*elementSize);
+}
+
+// Undo elements filter (delta/XOR) in place, elements in range [start, end), previous elements already restored
+// NOTE: Element is restored adding (or XOR) the element at stride bytes before, first elements have no previous element
+static void UndoElementsFilter(unsigned char *data, unsigned int start, unsigned int end, unsigned int elementSize, unsigned int stride, int mode)
+{
+    unsigned int i = (start < stride)? stride : start;
+
+#if defined(RRES_FILTER_SIMD_SSE2) || defined(RRES_FILTER_SIMD_NEON)
+    // NOTE: SIMD requires 16 bytes of previous data available, stride fitting a vector (power of two) or 8 bytes minimum
+    if ((i >= 16) && ((stride >= 8) || ((16 % stride) == 0)))
+    {
+    #if defined(RRES_FILTER_SIMD_SSE2)
+        i = UndoElementsFilterSSE2(data, i, end, elementSize, stride, mode);
+    #else
+        i = UndoElementsFilterNEON(data, i, end, elementSize, stride, mode);
+    #endif
+    }
+#endif
+
+    // Remaining elements, processed with element size values (little-endian)
+    switch (elementSize)
+    {
+        case 1:
+        {
+            for (; i < end; i++) data[i] = (mode == FILTER_MODE_XOR)? (data[i] ^ data[i - stride]) : (unsigned char)(data[i] + data[i - stride]);
+        } break;
+        case 2:
+        {
+            for (; (i + 2) <= end; i += 2)
+            {
+                unsigned short value = 0, previous = 0;
+                memcpy(&value, data + i, 2);
+                memcpy(&previous, data + i - stride, 2);
+                value = (mode == FILTER_MODE_XOR)? (value ^ previous) : (unsigned short)(value + previous);
+                memcpy(data + i, &value, 2);
+            }
+        } break;
+        case 4:
+        {
+            for (; (i + 4) <= end; i += 4)
+            {
+                unsigned int value = 0, previous = 0;
+                memcpy(&value, data + i, 4);
+                memcpy(&previous, data + i - stride, 4);
+                value = (mode == FILTER_MODE_XOR)? (value ^ previous) : (value + previous);
+                memcpy(data + i, &value, 4);
+            }
+        } break;
+        default:
+        {
+            for (; (i + 8) <= end; i += 8)
+            {
+                unsigned long long value = 0, previous = 0;
+                memcpy(&value, data + i, 8);
+                memcpy(&previous, data + i - stride, 8);
+                value = (mode == FILTER_MODE_XOR)? (value ^ previous) : (value + previous);
+                memcpy(data + i, &value, 8);
+            }
+        } break;
+    }
+}
+
+#if defined(RRES_FILTER_SIMD_SSE2)
+// Apply elements filter operation (add/XOR) to vectors, lanes of element size
+static inline __m128i ApplyFilterOpSSE2(__m128i a, __m128i b, unsigned int elementSize, int mode)
+{
+    if (mode == FILTER_MODE_XOR) return _mm_xor_si128(a, b);
+
+    switch (elementSize)
+    {
+        case 1: return _mm_add_epi8(a, b);
+        case 2: return _mm_add_epi16(a, b);
+        case 4: return _mm_add_epi32(a, b);
+        default: return _mm_add_epi64(a, b);
+    }
+}
+
+// Unshuffle tile bytes using SSE2 instructions, from start element, returns elements processed (16 elements per step)
+// NOTE: Byte planes are interleaved with unpack instructions: bytes, then 16-bit pairs, then 32-bit quads
+static unsigned int UnshuffleTileSSE2(unsigned char *output, const unsigned char *tile, unsigned int count, unsigned int elementSize, unsigned int start)
+{
+    unsigned int i = start;
+
+    if (elementSize == 2)
+    {
+        for (; (i + 16) <= count; i += 16)
+        {
+            __m128i a = _mm_loadu_si128((const __m128i *)(tile + i));
+            __m128i b = _mm_loadu_si128((const __m128i *)(tile + count + i));
+
+            _mm_storeu_si128((__m128i *)(output + 2*i), _mm_unpacklo_epi8(a, b));
+            _mm_storeu_si128((__m128i *)(output + 2*i + 16), _mm_unpackhi_epi8(a, b));
+        }
+    }
+    else if (elementSize == 4)
+    {
+        for (; (i + 16) <= count; i += 16)
+        {
+            __m128i a = _mm_loadu_si128((const __m128i *)(tile + i));
+            __m128i b = _mm_loadu_si128((const __m128i *)(tile + count + i));
+            __m128i c = _mm_loadu_si128((const __m128i *)(tile + 2*count + i));
+            __m128i d = _mm_loadu_si128((const __m128i *)(tile + 3*count + i));
+
+            __m128i abLo = _mm_unpacklo_epi8(a, b);
+            __m128i abHi = _mm_unpackhi_epi8(a, b);
+            __m128i cdLo = _mm_unpacklo_epi8(c, d);
+            __m128i cdHi = _mm_unpackhi_epi8(c, d);
+
+            _mm_storeu_si128((__m128i *)(output + 4*i), _mm_unpacklo_epi16(abLo, cdLo));
+            _mm_storeu_si128((__m128i *)(output + 4*i + 16), _mm_unpackhi_epi16(abLo, cdLo));
+            _mm_storeu_si128((__m128i *)(output + 4*i + 32), _mm_unpacklo_epi16(abHi, cdHi));
+            _mm_storeu_si128((__m128i *)(output + 4*i + 48), _mm_unpackhi_epi16(abHi, cdHi));
+        }
+    }
+    else if (elementSize == 8)
+    {
+        for (; (i + 16) <= count; i += 16)
+        {
+            __m128i pairs[8] = { 0 };   // Byte pairs (0,1), (2,3), (4,5), (6,7): elements 0..7 and 8..15
+            __m128i quads[8] = { 0 };   // Byte quads (0..3), (4..7): elements 0..3, 4..7, 8..11, 12..15
+
+            for (int p = 0; p < 4; p++)
+            {
+                __m128i a = _mm_loadu_si128((const __m128i *)(tile + (2*p)*count + i));
+                __m128i b = _mm_loadu_si128((const __m128i *)(tile + (2*p + 1)*count + i));
+                pairs[2*p] = _mm_unpacklo_epi8(a, b);
+                pairs[2*p + 1] = _mm_unpackhi_epi8(a, b);
+            }
+
+            for (int q = 0; q < 2; q++)
+            {
+                for (int h = 0; h < 2; h++)
+                {
+                    quads[4*q + 2*h] = _mm_unpacklo_epi16(pairs[4*q + h], pairs[4*q + 2 + h]);
+                    quads[4*q + 2*h + 1] = _mm_unpackhi_epi16(pairs[4*q + h], pairs[4*q + 2 + h]);
+                }
+            }
+
+            for (int e = 0; e < 4; e++)
+            {
+                _mm_storeu_si128((__m128i *)(output + 8*i + 32*e), _mm_unpacklo_epi32(quads[e], quads[4 + e]));
+                _mm_storeu_si128((__m128i *)(output + 8*i + 32*e + 16), _mm_unpackhi_epi32(quads[e], quads[4 + e]));
+            }
+        }
+    }
+
+    return i;
+}
+
+// Get last stride bytes of vector, repeated: previous elements for next vector
+static inline __m128i GetFilterCarrySSE2(__m128i value, unsigned int stride)
+{
+    switch (stride)
+    {
+        case 1: value = _mm_unpackhi_epi8(value, value); value = _mm_shufflehi_epi16(value, 0xff); return _mm_unpackhi_epi64(value, value);
+        case 2: value = _mm_shufflehi_epi16(value, 0xff); return _mm_unpackhi_epi64(value, value);
+        case 4: return _mm_shuffle_epi32(value, 0xff);
+        case 8: return _mm_unpackhi_epi64(value, value);
+        default: return value;
+    }
+}
+
+// Undo elements filter using SSE2 instructions, returns data position processed
+// NOTE: Stride covering a vector: previous elements are already restored, vectors processed directly,
+// stride fitting a vector: prefix computed in the vector (log steps), previous stride bytes added (repeated),
+// other strides (8..15 bytes): vectors processed by stride steps, lanes after stride bytes processed again on next step
+static unsigned int UndoElementsFilterSSE2(unsigned char *data, unsigned int start, unsigned int end, unsigned int elementSize, unsigned int stride, int mode)
+{
+    unsigned int i = start;
+
+    if (stride >= 16)
+    {
+        for (; (i + 16) <= end; i += 16)
+        {
+            __m128i value = _mm_loadu_si128((const __m128i *)(data + i));
+            __m128i previous = _mm_loadu_si128((const __m128i *)(data + i - stride));
+            _mm_storeu_si128((__m128i *)(data + i), ApplyFilterOpSSE2(value, previous, elementSize, mode));
+        }
+    }
+    else if ((16 % stride) == 0)
+    {
+        __m128i previous = GetFilterCarrySSE2(_mm_loadu_si128((const __m128i *)(data + i - 16)), stride);
+
+        for (; (i + 16) <= end; i += 16)
+        {
+            __m128i value = _mm_loadu_si128((const __m128i *)(data + i));
+
+            if (stride <= 1) value = ApplyFilterOpSSE2(value, _mm_slli_si128(value, 1), elementSize, mode);
+            if (stride <= 2) value = ApplyFilterOpSSE2(value, _mm_slli_si128(value, 2), elementSize, mode);
+            if (stride <= 4) value = ApplyFilterOpSSE2(value, _mm_slli_si128(value, 4), elementSize, mode);
+            if (stride <= 8) value = ApplyFilterOpSSE2(value, _mm_slli_si128(value, 8), elementSize, mode);
+
+            value = ApplyFilterOpSSE2(value, previous, elementSize, mode);
+            _mm_storeu_si128((__m128i *)(data + i), value);
+            previous = GetFilterCarrySSE2(value, stride);
+        }
+    }
+    else if ((i + 16) <= end)
+    {
+        // NOTE: Next input is loaded before storing (overwritten by invalid lanes), last input is restored
+        __m128i value = _mm_loadu_si128((const __m128i *)(data + i));
+
+        for (; (i + stride + 16) <= end; i += stride)
+        {
+            __m128i next = _mm_loadu_si128((const __m128i *)(data + i + stride));
+            __m128i previous = _mm_loadu_si128((const __m128i *)(data + i - stride));
+            _mm_storeu_si128((__m128i *)(data + i), ApplyFilterOpSSE2(value, previous, elementSize, mode));
+            value = next;
+        }
+
+        _mm_storeu_si128((__m128i *)(data + i), value);
+    }
+
+    return i;
+}
+#endif
+
+#if defined(RRES_FILTER_SIMD_AVX2)
+// Check AVX2 instructions support (runtime), CPU and OS (YMM registers state)
+static bool IsAVX2Supported(void)
+{
+    bool supported = false;
+
+#if defined(_MSC_VER)
+    int info[4] = { 0 };
+    __cpuid(info, 0);
+
+    if (info[0] >= 7)
+    {
+        // CPUID leaf 1: ECX bit 27 (OSXSAVE) and bit 28 (AVX), XCR0: XMM and YMM state enabled, CPUID leaf 7: EBX bit 5 (AVX2)
+        __cpuid(info, 1);
+        bool avx = ((info[2] & (1 << 27)) != 0) && ((info[2] & (1 << 28)) != 0) && ((_xgetbv(0) & 6) == 6);
+
+        __cpuidex(info, 7, 0);
+        supported = avx && ((info[1] & (1 << 5)) != 0);
+    }
+#else
+    supported = __builtin_cpu_supports("avx2");
+#endif
+
+    return supported;
+}
+
+// Unshuffle tile bytes using AVX2 instructions, returns elements processed (32 elements per step)
+// NOTE: Unpack instructions work on 128-bit lanes, lanes are reordered on store
+FILTER_AVX2_TARGET static unsigned int UnshuffleTileAVX2(unsigned char *output, const unsigned char *tile, unsigned int count, unsigned int elementSize)
+{
+    unsigned int i = 0;
+
+    if (elementSize == 2)
+    {
+        for (; (i + 32) <= count; i += 32)
+        {
+            __m256i a = _mm256_loadu_si256((const __m256i *)(tile + i));
+            __m256i b = _mm256_loadu_si256((const __m256i *)(tile + count + i));
+            __m256i lo = _mm256_unpacklo_epi8(a, b);    // Elements 0..7, 16..23
+            __m256i hi = _mm256_unpackhi_epi8(a, b);    // Elements 8..15, 24..31
+
+            _mm256_storeu_si256((__m256i *)(output + 2*i), _mm256_permute2x128_si256(lo, hi, 0x20));
+            _mm256_storeu_si256((__m256i *)(output + 2*i + 32), _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+    }
+    else if (elementSize == 4)
+    {
+        for (; (i + 32) <= count; i += 32)
+        {
+            __m256i a = _mm256_loadu_si256((const __m256i *)(tile + i));
+            __m256i b = _mm256_loadu_si256((const __m256i *)(tile + count + i));
+            __m256i c = _mm256_loadu_si256((const __m256i *)(tile + 2*count + i));
+            __m256i d = _mm256_loadu_si256((const __m256i *)(tile + 3*count + i));
+
+            __m256i abLo = _mm256_unpacklo_epi8(a, b);
+            __m256i abHi = _mm256_unpackhi_epi8(a, b);
+            __m256i cdLo = _mm256_unpacklo_epi8(c, d);
+            __m256i cdHi = _mm256_unpackhi_epi8(c, d);
+
+            __m256i e0 = _mm256_unpacklo_epi16(abLo, cdLo);   // Elements 0..3, 16..19
+            __m256i e1 = _mm256_unpackhi_epi16(abLo, cdLo);   // Elements 4..7, 20..23
+            __m256i e2 = _mm256_unpacklo_epi16(abHi, cdHi);   // Elements 8..11, 24..27
+            __m256i e3 = _mm256_unpackhi_epi16(abHi, cdHi);   // Elements 12..15, 28..31
+
+            _mm256_storeu_si256((__m256i *)(output + 4*i), _mm256_permute2x128_si256(e0, e1, 0x20));
+            _mm256_storeu_si256((__m256i *)(output + 4*i + 32), _mm256_permute2x128_si256(e2, e3, 0x20));
+            _mm256_storeu_si256((__m256i *)(output + 4*i + 64), _mm256_permute2x128_si256(e0, e1, 0x31));
+            _mm256_storeu_si256((__m256i *)(output + 4*i + 96), _mm256_permute2x128_si256(e2, e3, 0x31));
+        }
+    }
+
+    // Remaining elements processed with SSE2
+    return UnshuffleTileSSE2(output, tile, count, elementSize, i);
+}
+#endif
+
+#if defined(RRES_FILTER_SIMD_NEON)
+// Apply elements filter operation (add/XOR) to vectors, lanes of element size
+static inline uint8x16_t ApplyFilterOpNEON(uint8x16_t a, uint8x16_t b, unsigned int elementSize, int mode)
+{
+    if (mode == FILTER_MODE_XOR) return veorq_u8(a, b);
+
+    switch (elementSize)
+    {
+        case 1: return vaddq_u8(a, b);
+        case 2: return vreinterpretq_u8_u16(vaddq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b)));
+        case 4: return vreinterpretq_u8_u32(vaddq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b)));
+        default: return vreinterpretq_u8_u64(vaddq_u64(vreinterpretq_u64_u8(a), vreinterpretq_u64_u8(b)));
+    }
+}
+
+// Unshuffle tile bytes using NEON instructions, returns elements processed (16 elements per step)
+// NOTE: Interleaved stores for 2 and 4 byte planes, zip instructions for 8 byte planes
+static unsigned int UnshuffleTileNEON(unsigned char *output, const unsigned char *tile, unsigned int count, unsigned int elementSize)
+{
+    unsigned int i = 0;
+
+    if (elementSize == 2)
+    {
+        for (; (i + 16) <= count; i += 16)
+        {
+            uint8x16x2_t planes = { { vld1q_u8(tile + i), vld1q_u8(tile + count + i) } };
+            vst2q_u8(output + 2*i, planes);
+        }
+    }
+    else if (elementSize == 4)
+    {
+        for (; (i + 16) <= count; i += 16)
+        {
+            uint8x16x4_t planes = { { vld1q_u8(tile + i), vld1q_u8(tile + count + i), vld1q_u8(tile + 2*count + i), vld1q_u8(tile + 3*count + i) } };
+            vst4q_u8(output + 4*i, planes);
+        }
+    }
+    else if (elementSize == 8)
+    {
+        for (; (i + 16) <= count; i += 16)
+        {
+            uint16x8x2_t pairs[4];      // Byte pairs (0,1), (2,3), (4,5), (6,7): elements 0..7 and 8..15
+            uint32x4x2_t quads[4];      // Byte quads (0..3), (4..7): elements 0..3, 4..7 and 8..11, 12..15
+
+            for (int p = 0; p < 4; p++)
+            {
+                uint8x16x2_t zip = vzipq_u8(vld1q_u8(tile + (2*p)*count + i), vld1q_u8(tile + (2*p + 1)*count + i));
+                pairs[p].val[0] = vreinterpretq_u16_u8(zip.val[0]);
+                pairs[p].val[1] = vreinterpretq_u16_u8(zip.val[1]);
+            }
+
+            for (int q = 0; q < 2; q++)
+            {
+                for (int h = 0; h < 2; h++)
+                {
+                    uint16x8x2_t zip = vzipq_u16(pairs[2*q].val[h], pairs[2*q + 1].val[h]);
+                    quads[2*q + h].val[0] = vreinterpretq_u32_u16(zip.val[0]);
+                    quads[2*q + h].val[1] = vreinterpretq_u32_u16(zip.val[1]);
+                }
+            }
+
+            for (int e = 0; e < 4; e++)
+            {
+                uint32x4x2_t zip = vzipq_u32(quads[e/2].val[e%2], quads[2 + e/2].val[e%2]);
+                vst1q_u8(output + 8*i + 32*e, vreinterpretq_u8_u32(zip.val[0]));
+                vst1q_u8(output + 8*i + 32*e + 16, vreinterpretq_u8_u32(zip.val[1]));
+            }
+        }
+    }
+
+    return i;
+}
+
+// Get last stride bytes of vector, repeated: previous elements for next vector
+static inline uint8x16_t GetFilterCarryNEON(uint8x16_t value, unsigned int stride)
+{
+    switch (stride)
+    {
+        case 1: return vdupq_n_u8(vgetq_lane_u8(value, 15));
+        case 2: return vreinterpretq_u8_u16(vdupq_n_u16(vgetq_lane_u16(vreinterpretq_u16_u8(value), 7)));
+        case 4: return vreinterpretq_u8_u32(vdupq_n_u32(vgetq_lane_u32(vreinterpretq_u32_u8(value), 3)));
+        case 8: return vreinterpretq_u8_u64(vdupq_n_u64(vgetq_lane_u64(vreinterpretq_u64_u8(value), 1)));
+        default: return value;
+    }
+}
+
+// Undo elements filter using NEON instructions, returns data position processed
+// NOTE: Same approach than UndoElementsFilterSSE2(), vector shifted with vextq_u8()
+static unsigned int UndoElementsFilterNEON(unsigned char *data, unsigned int start, unsigned int end, unsigned int elementSize, unsigned int stride, int mode)
+{
+    unsigned int i = start;
+    uint8x16_t zero = vdupq_n_u8(0);
+
+    if (stride >= 16)
+    {
+        for (; (i + 16) <= end; i += 16) vst1q_u8(data + i, ApplyFilterOpNEON(vld1q_u8(data + i), vld1q_u8(data + i - stride), elementSize, mode));
+    }
+    else if ((16 % stride) == 0)
+    {
+        uint8x16_t previous = GetFilterCarryNEON(vld1q_u8(data + i - 16), stride);
+
+        for (; (i + 16) <= end; i += 16)
+        {
+            uint8x16_t value = vld1q_u8(data + i);
+
+            if (stride <= 1) value = ApplyFilterOpNEON(value, vextq_u8(zero, value, 15), elementSize, mode);
+            if (stride <= 2) value = ApplyFilterOpNEON(value, vextq_u8(zero, value, 14), elementSize, mode);
+            if (stride <= 4) value = ApplyFilterOpNEON(value, vextq_u8(zero, value, 12), elementSize, mode);
+            if (stride <= 8) value = ApplyFilterOpNEON(value, vextq_u8(zero, value, 8), elementSize, mode);
+
+            value = ApplyFilterOpNEON(value, previous, elementSize, mode);
+            vst1q_u8(data + i, value);
+            previous = GetFilterCarryNEON(value, stride);
+        }
+    }
+    else if ((i + 16) <= end)
+    {
+        uint8x16_t value = vld1q_u8(data + i);
+
+        for (; (i + stride + 16) <= end; i += stride)
+        {
+            uint8x16_t next = vld1q_u8(data + i + stride);
+            vst1q_u8(data + i, ApplyFilterOpNEON(value, vld1q_u8(data + i - stride), elementSize, mode));
+            value = next;
+        }
+
+        vst1q_u8(data + i, value);
+    }
+
+    return i;
+}
+#endif
+
+// Expand quantized vertex data to float: normalized*scale + offset, scale/offset per component
+// NOTE 1: Half-float values are converted, snorm16 (SHORT) normalized to [-1..1] and unorm16 (USHORT) to [0..1]
+// NOTE 2: Input vertices are stride bytes apart (interleaved data), packed values are processed with SIMD instructions
+static void DequantizeVertexData(float *output, const unsigned char *data, unsigned int vertexCount, unsigned int componentCount, unsigned int format, const float *scale, const float *offset, unsigned int stride)
+{
+    unsigned int count = vertexCount*componentCount;
+    unsigned int i = 0;
+
+#if defined(RRES_FILTER_SIMD_SSE2) || defined(RRES_FILTER_SIMD_NEON)
+    if (stride == componentCount*2)
+    {
+        // Scale/offset repeated to fit SIMD steps: pattern size is a multiple of any components count
+        float scalePattern[VERTEX_QUANT_PATTERN_SIZE] = { 0 };
+        float offsetPattern[VERTEX_QUANT_PATTERN_SIZE] = { 0 };
+
+        for (int k = 0; k < VERTEX_QUANT_PATTERN_SIZE; k++)
+        {
+            scalePattern[k] = scale[k%componentCount];
+            offsetPattern[k] = offset[k%componentCount];
+        }
+
+    #if defined(RRES_FILTER_SIMD_AVX2)
+        if (filterAVX2 < 0) filterAVX2 = IsAVX2Supported()? 1 : 0;
+
+        if (filterAVX2 == 1) i = DequantizeVertexDataAVX2(output, data, count, format, scalePattern, offsetPattern);
+        else i = DequantizeVertexDataSSE2(output, data, count, format, scalePattern, offsetPattern);
+    #elif defined(RRES_FILTER_SIMD_SSE2)
+        i = DequantizeVertexDataSSE2(output, data, count, format, scalePattern, offsetPattern);
+    #elif defined(RRES_FILTER_SIMD_NEON)
+        i = DequantizeVertexDataNEON(output, data, count, format, scalePattern, offsetPattern);
+    #endif
+    }
+#endif
+
+    // Remaining values (not fitting SIMD steps or interleaved)
+    for (; i < count; i++)
+    {
+        unsigned int c = i%componentCount;
+        unsigned short value = 0;
+        float normalized = 0.0f;
+
+        memcpy(&value, data + (size_t)(i/componentCount)*stride + c*2, 2);
+
+        if (format == RRES_VERTEX_FORMAT_SHORT)
+        {
+            normalized = (float)(short)value*(1.0f/32767.0f);
+            if (normalized < -1.0f) normalized = -1.0f;
+        }
+        else if (format == RRES_VERTEX_FORMAT_USHORT) normalized = (float)value*(1.0f/65535.0f);
+        else normalized = HalfToFloat(value);
+
+        output[i] = normalized*scale[c] + offset[c];
+    }
+}
+
+// Convert half-float value to float
+// NOTE: Exponent/mantissa bits shifted into float position, rebiased multiplying by 2^112 (denormals normalized),
+// infinity/NaN exponent set directly
+static float HalfToFloat(unsigned short value)
+{
+    unsigned int expMant = value & 0x7fff;
+    unsigned int bits = expMant << 13;
+    float result = 0.0f;
+    float magic = 0.0f;
+    unsigned int magicBits = 0x77800000;     // 2^112: (254 - 15) << 23
+
+    memcpy(&result, &bits, 4);
+    memcpy(&magic, &magicBits, 4);
+    result *= magic;
+
+    memcpy(&bits, &result, 4);
+    if (expMant >= 0x7c00) bits |= 0x7f800000;
+    bits |= (unsigned int)(value & 0x8000) << 16;
+    memcpy(&result, &bits, 4);
+
+    return result;
+}
+
+// Convert float value to half-float (round to nearest even)
+// NOTE: Values over half-float range are converted to infinity, values under it are converted to denormals
+static unsigned short FloatToHalf(float value)
+{
+    unsigned int bits = 0;
+    unsigned short result = 0;
+
+    memcpy(&bits, &value, 4);
+
+    unsigned int sign = (bits >> 16) & 0x8000;
+    bits &= 0x7fffffff;
+
+    if (bits >= 0x47800000) result = (unsigned short)((bits > 0x7f800000)? 0x7e00 : 0x7c00);   // NaN or infinity (overflow)
+    else if (bits < 0x38800000)
+    {
+        // Denormal (or zero): rounding done by float addition, aligning mantissa bits (0.5f magic)
+        float denormal = 0.0f;
+        memcpy(&denormal, &bits, 4);
+        denormal += 0.5f;
+        memcpy(&bits, &denormal, 4);
+        result = (unsigned short)(bits - 0x3f000000);
+    }
+    else
+    {
+        // Normal: exponent rebiased, mantissa rounded to nearest even (carry can overflow to infinity)
+        bits += 0xc8000fff + ((bits >> 13) & 1);
+        result = (unsigned short)(bits >> 13);
+    }
+
+    return (unsigned short)(result | sign);
+}
+
+#if defined(RRES_FILTER_SIMD_SSE2)
+// Expand quantized vertex values to float using SSE2 instructions, returns values processed (24 values per step)
+// NOTE: Half-float conversion with integer instructions (no F16C required), same approach than HalfToFloat()
+static unsigned int DequantizeVertexDataSSE2(float *output, const unsigned char *data, unsigned int count, unsigned int format, const float *scale, const float *offset)
+{
+    unsigned int i = 0;
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; (i + VERTEX_QUANT_PATTERN_SIZE) <= count; i += VERTEX_QUANT_PATTERN_SIZE)
+    {
+        for (int k = 0; k < VERTEX_QUANT_PATTERN_SIZE; k += 8)
+        {
+            __m128i values = _mm_loadu_si128((const __m128i *)(data + 2*(i + k)));
+            __m128 lo, hi;
+
+            if (format == RRES_VERTEX_FORMAT_SHORT)
+            {
+                // Sign extension: 16-bit value in high half, arithmetic shift
+                lo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(values, values), 16)), _mm_set1_ps(1.0f/32767.0f));
+                hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(values, values), 16)), _mm_set1_ps(1.0f/32767.0f));
+                lo = _mm_max_ps(lo, _mm_set1_ps(-1.0f));
+                hi = _mm_max_ps(hi, _mm_set1_ps(-1.0f));
+            }
+            else if (format == RRES_VERTEX_FORMAT_USHORT)
+            {
+                lo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(values, zero)), _mm_set1_ps(1.0f/65535.0f));
+                hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(values, zero)), _mm_set1_ps(1.0f/65535.0f));
+            }
+            else
+            {
+                __m128i halfs[2] = { _mm_unpacklo_epi16(values, zero), _mm_unpackhi_epi16(values, zero) };
+                __m128 floats[2];
+
+                for (int h = 0; h < 2; h++)
+                {
+                    __m128i expMant = _mm_and_si128(halfs[h], _mm_set1_epi32(0x7fff));
+                    __m128i sign = _mm_slli_epi32(_mm_xor_si128(halfs[h], expMant), 16);
+                    __m128i infNaN = _mm_and_si128(_mm_cmpgt_epi32(expMant, _mm_set1_epi32(0x7bff)), _mm_set1_epi32(0x7f800000));
+                    __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expMant, 13)), _mm_castsi128_ps(_mm_set1_epi32(0x77800000)));
+                    floats[h] = _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, infNaN)));
+                }
+
+                lo = floats[0];
+                hi = floats[1];
+            }
+
+            _mm_storeu_ps(output + i + k, _mm_add_ps(_mm_mul_ps(lo, _mm_loadu_ps(scale + k)), _mm_loadu_ps(offset + k)));
+            _mm_storeu_ps(output + i + k + 4, _mm_add_ps(_mm_mul_ps(hi, _mm_loadu_ps(scale + k + 4)), _mm_loadu_ps(offset + k + 4)));
+        }
+    }
+
+    return i;
+}
+#endif
+
+#if defined(RRES_FILTER_SIMD_AVX2)
+// Expand quantized vertex values to float using AVX2 instructions, returns values processed (24 values per step)
+// NOTE: 8 values widened to 32-bit lanes per vector, same conversions than DequantizeVertexDataSSE2()
+FILTER_AVX2_TARGET static unsigned int DequantizeVertexDataAVX2(float *output, const unsigned char *data, unsigned int count, unsigned int format, const float *scale, const float *offset)
+{
+    unsigned int i = 0;
+
+    for (; (i + VERTEX_QUANT_PATTERN_SIZE) <= count; i += VERTEX_QUANT_PATTERN_SIZE)
+    {
+        for (int k = 0; k < VERTEX_QUANT_PATTERN_SIZE; k += 8)
+        {
+            __m128i values = _mm_loadu_si128((const __m128i *)(data + 2*(i + k)));
+            __m256 result;
+
+            if (format == RRES_VERTEX_FORMAT_SHORT)
+            {
+                result = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(values)), _mm256_set1_ps(1.0f/32767.0f));
+                result = _mm256_max_ps(result, _mm256_set1_ps(-1.0f));
+            }
+            else if (format == RRES_VERTEX_FORMAT_USHORT) result = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(values)), _mm256_set1_ps(1.0f/65535.0f));
+            else
+            {
+                __m256i halfs = _mm256_cvtepu16_epi32(values);
+                __m256i expMant = _mm256_and_si256(halfs, _mm256_set1_epi32(0x7fff));
+                __m256i sign = _mm256_slli_epi32(_mm256_xor_si256(halfs, expMant), 16);
+                __m256i infNaN = _mm256_and_si256(_mm256_cmpgt_epi32(expMant, _mm256_set1_epi32(0x7bff)), _mm256_set1_epi32(0x7f800000));
+                __m256 scaled = _mm256_mul_ps(_mm256_castsi256_ps(_mm256_slli_epi32(expMant, 13)), _mm256_castsi256_ps(_mm256_set1_epi32(0x77800000)));
+                result = _mm256_or_ps(scaled, _mm256_castsi256_ps(_mm256_or_si256(sign, infNaN)));
+            }
+
+            _mm256_storeu_ps(output + i + k, _mm256_add_ps(_mm256_mul_ps(result, _mm256_loadu_ps(scale + k)), _mm256_loadu_ps(offset + k)));
+        }
+    }
+
+    return i;
+}
+#endif
+
+#if defined(RRES_FILTER_SIMD_NEON)
+// Expand quantized vertex values to float using NEON instructions, returns values processed (24 values per step)
+// NOTE: Same conversions than DequantizeVertexDataSSE2(), values loaded as bytes (no alignment required)
+static unsigned int DequantizeVertexDataNEON(float *output, const unsigned char *data, unsigned int count, unsigned int format, const float *scale, const float *offset)
+{
+    unsigned int i = 0;
+
+    for (; (i + VERTEX_QUANT_PATTERN_SIZE) <= count; i += VERTEX_QUANT_PATTERN_SIZE)
+    {
+        for (int k = 0; k < VERTEX_QUANT_PATTERN_SIZE; k += 8)
+        {
+            uint16x8_t values = vreinterpretq_u16_u8(vld1q_u8(data + 2*(i + k)));
+            float32x4_t lo, hi;
+
+            if (format == RRES_VERTEX_FORMAT_SHORT)
+            {
+                int16x8_t signedValues = vreinterpretq_s16_u16(values);
+                lo = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(signedValues))), 1.0f/32767.0f);
+                hi = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(signedValues))), 1.0f/32767.0f);
+                lo = vmaxq_f32(lo, vdupq_n_f32(-1.0f));
+                hi = vmaxq_f32(hi, vdupq_n_f32(-1.0f));
+            }
+            else if (format == RRES_VERTEX_FORMAT_USHORT)
+            {
+                lo = vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(values))), 1.0f/65535.0f);
+                hi = vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(values))), 1.0f/65535.0f);
+            }
+            else
+            {
+                uint32x4_t halfs[2] = { vmovl_u16(vget_low_u16(values)), vmovl_u16(vget_high_u16(values)) };
+                float32x4_t floats[2];
+
+                for (int h = 0; h < 2; h++)
+                {
+                    uint32x4_t expMant = vandq_u32(halfs[h], vdupq_n_u32(0x7fff));
+                    uint32x4_t sign = vshlq_n_u32(veorq_u32(halfs[h], expMant), 16);
+                    uint32x4_t infNaN = vandq_u32(vcgtq_u32(expMant, vdupq_n_u32(0x7bff)), vdupq_n_u32(0x7f800000));
+                    float32x4_t scaled = vmulq_f32(vreinterpretq_f32_u32(vshlq_n_u32(expMant, 13)), vreinterpretq_f32_u32(vdupq_n_u32(0x77800000)));
+                    floats[h] = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(scaled), vorrq_u32(sign, infNaN)));
+                }
+
+                lo = floats[0];
+                hi = floats[1];
+            }
+
+            vst1q_f32(output + i + k, vaddq_f32(vmulq_f32(lo, vld1q_f32(scale + k)), vld1q_f32(offset + k)));
+            vst1q_f32(output + i + k + 4, vaddq_f32(vmulq_f32(hi, vld1q_f32(scale + k + 4)), vld1q_f32(offset + k + 4)));
+        }
+    }
+
+    return i;
+}
+#endif
+
+// Get threads used to unpack large chunks (1 if threads not supported)
+static unsigned int GetUnpackThreadCount(void)
+{
+    unsigned int count = 1;
+
+#if defined(RRES_SUPPORT_THREADS)
+    if (unpackThreads > 0) count = (unsigned int)unpackThreads;
+    else
+    {
+    #if defined(_WIN32)
+        count = (unsigned int)GetActiveProcessorCount(0xffff);     // ALL_PROCESSOR_GROUPS
+    #elif defined(_SC_NPROCESSORS_ONLN)
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        if (cores > 0) count = (unsigned int)cores;
+    #endif
+    }
+
+    if (count < 1) count = 1;
+    if (count > THREADS_MAX) count = THREADS_MAX;
+#endif
+
+    return count;
+}
+
+// Run jobs [0..count-1], distributed in multiple threads
+// NOTE: Jobs are processed by the calling thread and the pool worker threads, every thread claims next job index
+// until all jobs are claimed, if threads are not supported (or pool is busy) jobs are processed in calling thread
+static void RunParallelJobs(ParallelJobFunc func, void *data, unsigned int count)
+{
+    unsigned int threadCount = GetUnpackThreadCount();
+    if (threadCount > count) threadCount = count;
+
+#if defined(RRES_SUPPORT_THREADS)
+    if (threadCount > 1)
+    {
+        JOB_POOL_LOCK();
+
+        if (!jobPool.busy)
+        {
+            // Create required worker threads, calling thread also processes jobs
+            while ((jobPool.threadCount < (threadCount - 1)) && StartJobPoolThread(jobPool.threadCount)) jobPool.threadCount++;
+
+            jobPool.func = func;
+            jobPool.data = data;
+            jobPool.count = count;
+            jobPool.next = 0;
+            jobPool.workers = ((threadCount - 1) < jobPool.threadCount)? (threadCount - 1) : jobPool.threadCount;
+            jobPool.pending = jobPool.workers;
+            jobPool.generation++;
+            jobPool.busy = true;
+            JOB_POOL_WAKE(jobPoolStart);
+
+            ProcessPoolJobs();
+
+            // Wait for workers to finish their claimed jobs
+            while (jobPool.pending > 0) JOB_POOL_WAIT(jobPoolDone);
+
+            jobPool.busy = false;
+            JOB_POOL_UNLOCK();
+
+            return;
+        }
+
+        JOB_POOL_UNLOCK();
+    }
+#endif
+
+    for (unsigned int i = 0; i < count; i++) func(data, i);
+}
 
-        } break;
-    }
+#if defined(RRES_SUPPORT_THREADS)
+// Start parallel jobs pool worker thread
+// NOTE: Pool lock must be held, worker thread starts waiting for next jobs generation
+static bool StartJobPoolThread(unsigned int index)
+{
+    bool started = false;
+    jobPool.seen[index] = jobPool.generation;
 
-    if ((result == 0) && (chunk->info.cipherType != RRES_CIPHER_NONE))
+#if defined(_WIN32)
+    void *thread = CreateThread(NULL, 0, ParallelJobThread, (void *)(size_t)index, 0, NULL);
+    if (thread != NULL)
     {
-        // Data is not encrypted any more, register it
-        chunk->info.cipherType = RRES_CIPHER_NONE;
-        updateProps = true;
+        CloseHandle(thread);    // Thread is not joined, it keeps running waiting for jobs
+        started = true;
     }
+#else
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, ParallelJobThread, (void *)(size_t)index) == 0)
+    {
+        pthread_detach(thread); // Thread is not joined, it keeps running waiting for jobs
+        started = true;
+    }
+#endif
 
-    // STEP 2: Data decompression (if decryption was successful)
-    //-------------------------------------------------------------------------------------
-    unsigned char *uncompData = NULL;
+    return started;
+}
 
-    if (result == 0)
+// Process pool jobs until all claimed, pool lock must be held
+// NOTE: Lock is released while processing every job
+static void ProcessPoolJobs(void)
+{
+    while (jobPool.next < jobPool.count)
     {
-        switch (chunk->info.compType)
-        {
-            case RRES_COMP_NONE: unpackedData = decryptedData; break;
-            case RRES_COMP_DEFLATE:
-            {
-                int uncompDataSize = 0;
+        unsigned int index = jobPool.next++;
+        ParallelJobFunc func = jobPool.func;
+        void *data = jobPool.data;
 
-                // TODO: WARNING: Possible issue with allocators: RL_CALLOC() vs RRES_CALLOC()
-                uncompData = DecompressData(decryptedData, chunk->info.packedSize, &uncompDataSize);
+        JOB_POOL_UNLOCK();
+        func(data, index);
+        JOB_POOL_LOCK();
+    }
+}
 
-                if ((uncompData != NULL) && (uncompDataSize > 0))     // Decompression successful
-                {
-                    unpackedData = uncompData;
-                    chunk->info.packedSize = uncompDataSize;
-                    RRES_LOG("RRES: %c%c%c%c: Data decompressed successfully (DEFLATE)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-                }
-                else
-                {
-                    result = 4;    // Decompression process failed
-                    RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data decompression failed\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-                }
+// Parallel jobs worker thread entry point
+// NOTE: Worker waits for a new jobs generation, it only processes jobs if it's required for that generation
+#if defined(_WIN32)
+static unsigned long __stdcall ParallelJobThread(void *arg)
+#else
+static void *ParallelJobThread(void *arg)
+#endif
+{
+    unsigned int index = (unsigned int)(size_t)arg;
 
-                // Security check, uncompDataSize must match the provided chunk->baseSize
-                if ((unsigned int)uncompDataSize != chunk->info.baseSize) RRES_LOG("RRES: WARNING: Decompressed data could be corrupted, unexpected size\n");
-            } break;
-#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
-            case RRES_COMP_LZ4:
-            {
-                int uncompDataSize = 0;
-                uncompData = (unsigned char *)RRES_CALLOC(chunk->info.baseSize, 1);
-                uncompDataSize = LZ4_decompress_safe((char *)decryptedData, (char *)uncompData, chunk->info.packedSize, chunk->info.baseSize);
+    JOB_POOL_LOCK();
 
-                if ((uncompData != NULL) && (uncompDataSize > 0))     // Decompression successful
-                {
-                    unpackedData = uncompData;
-                    chunk->info.packedSize = uncompDataSize;
-                    RRES_LOG("RRES: %c%c%c%c: Data decompressed successfully (LZ4)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-                }
-                else
-                {
-                    result = 4;    // Decompression process failed
-                    RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data decompression failed\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-                }
+    while (true)
+    {
+        while (jobPool.seen[index] == jobPool.generation) JOB_POOL_WAIT(jobPoolStart);
+        jobPool.seen[index] = jobPool.generation;
 
-                // WARNING: Decompression could be successful but not the original message size returned
-                if (uncompDataSize != chunk->info.baseSize) RRES_LOG("RRES: WARNING: Decompressed data could be corrupted, unexpected size\n");
-            } break;
+        if (index < jobPool.workers)
+        {
+            ProcessPoolJobs();
+
+            jobPool.pending--;
+            if (jobPool.pending == 0) JOB_POOL_WAKE(jobPoolDone);
+        }
+    }
+
+    JOB_POOL_UNLOCK();
+
+    return 0;
+}
 #endif
-            case RRES_COMP_QOI:
-            {
-                int uncompDataSize = 0;
-                qoi_desc desc = { 0 };
 
-                // TODO: WARNING: Possible issue with allocators: QOI_MALLOC() vs RRES_MALLOC()
-                uncompData = (unsigned char *)qoi_decode(decryptedData, chunk->info.packedSize, &desc, 0);
-                uncompDataSize = (desc.width*desc.height*desc.channels) + 20;   // Add the 20 bytes of (propCount + props[4])
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+// Derive encryption key from user password and salt, using Argon2i algorithm (256 bit)
+// NOTE: Derived keys are cached by (password, salt), least-recently-used key is replaced when cache is full
+static void DeriveCipherKey(unsigned char *key, const unsigned char *salt)
+{
+    const char *pass = rresGetCipherPassword();
+    unsigned char passHash[32] = { 0 };
+    crypto_blake2b(passHash, 32, (const uint8_t *)pass, strlen(pass));
 
-                if ((uncompData != NULL) && (uncompDataSize > 0))     // Decompression successful
-                {
-                    unpackedData = uncompData;
-                    chunk->info.packedSize = uncompDataSize;
-                    RRES_LOG("RRES: %c%c%c%c: Data decompressed successfully (QOI)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-                }
-                else
-                {
-                    result = 4;    // Decompression process failed
-                    RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data decompression failed\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-                }
+    // Look for key in cache, keeping track of the least-recently-used entry
+    bool found = false;
+    int slot = 0;
 
-                if ((unsigned int)uncompDataSize != chunk->info.baseSize) RRES_LOG("RRES: WARNING: Decompressed data could be corrupted, unexpected size\n");
-            } break;
-            default:
-            {
-                result = 3;
-                RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data compression algorithm not supported\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-            } break;
+    for (int i = 0; i < RRES_CIPHER_KEY_CACHE_SIZE; i++)
+    {
+        if ((cipherKeys[i].lastUse > 0) && (memcmp(cipherKeys[i].salt, salt, 16) == 0) && (crypto_verify32(cipherKeys[i].passHash, passHash) == 0))
+        {
+            memcpy(key, cipherKeys[i].key, 32);
+            cipherKeys[i].lastUse = ++cipherKeysTick;
+            found = true;
+            break;
         }
+
+        if (cipherKeys[i].lastUse < cipherKeys[slot].lastUse) slot = i;
     }
 
-    if ((result == 0) && (chunk->info.compType != RRES_COMP_NONE))
+    if (!found)
+    {
+        // Key stretching configuration
+        crypto_argon2_config config = {
+            .algorithm = CRYPTO_ARGON2_I,           // Algorithm: Argon2i
+            .nb_blocks = 16384,                     // Blocks: 16 MB
+            .nb_passes = 3,                         // Iterations
+            .nb_lanes  = 1                          // Single-threaded
+        };
+        crypto_argon2_inputs inputs = {
+            .pass = (const uint8_t *)pass,          // User password
+            .salt = salt,                           // Salt for the password
+            .pass_size = (uint32_t)strlen(pass),    // Password length
+            .salt_size = 16
+        };
+        crypto_argon2_extras extras = { 0 };        // Extra parameters unused
+
+        void *workArea = RL_MALLOC(config.nb_blocks*1024);    // Key stretching work area
+        RRES_STATS_RECORD(RRES_STATS_EVENT_ALLOC, 0, config.nb_blocks*1024);
+
+        RRES_STATS_BEGIN(keyTimer);
+        crypto_argon2(key, 32, workArea, config, inputs, extras);
+        RRES_STATS_END(RRES_STATS_EVENT_KEY, 0, keyTimer);
+
+        RL_FREE(workArea);
+        RRES_STATS_RECORD(RRES_STATS_EVENT_FREE, 0, config.nb_blocks*1024);
+
+        // Register derived key in cache
+        memcpy(cipherKeys[slot].passHash, passHash, 32);
+        memcpy(cipherKeys[slot].salt, salt, 16);
+        memcpy(cipherKeys[slot].key, key, 32);
+        cipherKeys[slot].lastUse = ++cipherKeysTick;
+    }
+
+    crypto_wipe(passHash, 32);
+}
+
+// Get random bytes for salt/nonce generation, returns false if system random source is not available
+// NOTE: System cryptographically secure random source is required: BCryptGenRandom() (Windows), arc4random_buf() (macOS),
+// getrandom() (Linux) or /dev/urandom, no fallback is used, salt/nonce reuse would reuse cipher keystream
+static bool GetRandomBytes(unsigned char *buffer, unsigned int size)
+{
+    bool success = false;
+
+#if defined(_WIN32)
+    success = (BCryptGenRandom(NULL, buffer, size, 0x00000002) >= 0);  // BCRYPT_USE_SYSTEM_PREFERRED_RNG
+#elif defined(__APPLE__)
+    arc4random_buf(buffer, size);
+    success = true;
+#else
+    unsigned int count = 0;
+
+    #if defined(RRES_RANDOM_GETRANDOM)
+    while (count < size)
     {
-        // Data is not encrypted any more, register it
-        chunk->info.compType = RRES_COMP_NONE;
-        updateProps = true;
+        ssize_t result = getrandom(buffer + count, size - count, 0);
+
+        if (result > 0) count += (unsigned int)result;
+        else if ((result < 0) && (errno == EINTR)) continue;
+        else break;
     }
+    #endif
 
-    // Update chunk->data.propCount and chunk->data.props if required
-    if (updateProps && (unpackedData != NULL))
+    // NOTE: /dev/urandom is used if getrandom() is not available (i.e. older kernel)
+    if (count < size)
     {
-        // Data is decompressed/decrypted into chunk->data.raw but data.propCount and data.props[] are still empty,
-        // they must be filled with the just updated chunk->data.raw (that contains everything)
-        chunk->data.propCount = ((int *)unpackedData)[0];
+        FILE *source = fopen("/dev/urandom", "rb");
 
-        if (chunk->data.propCount > 0)
+        if (source != NULL)
         {
-            chunk->data.props = (unsigned int *)RRES_CALLOC(chunk->data.propCount, sizeof(int));
-            for (unsigned int i = 0; i < chunk->data.propCount; i++) chunk->data.props[i] = ((int *)unpackedData)[1 + i];
+            count = (unsigned int)fread(buffer, 1, size, source);
+            fclose(source);
         }
+    }
 
-        // Move chunk->data.raw pointer (chunk->data.propCount*sizeof(int)) positions
-        void *raw = RRES_CALLOC(chunk->info.baseSize - 20, 1);
-        if (raw != NULL) memcpy(raw, ((unsigned char *)unpackedData) + 20, chunk->info.baseSize - 20);
-        RRES_FREE(chunk->data.raw);
-        chunk->data.raw = raw;
-        RL_FREE(unpackedData);
+    success = (count == size);
+#endif
+
+    if (!success) RRES_LOG("RRES: WARNING: System random source not available, data can not be encrypted\n");
+
+    return success;
+}
+#endif
+
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+// Decrypt data in place (XChaCha20-Poly1305), MAC verified before decryption
+// NOTE: Large data is decrypted by segments in parallel (ChaCha20 keystream is seekable by block counter),
+// Poly1305 MAC is computed over encrypted data, so it's verified first in a single pass, same as crypto_aead_unlock()
+static int DecryptXChaCha20Poly1305(unsigned char *data, size_t size, const unsigned char *key, const unsigned char *nonce, const unsigned char *mac)
+{
+    int result = 0;
+    unsigned int segmentCount = (unsigned int)((size + RRES_PARALLEL_SEGMENT_SIZE - 1)/RRES_PARALLEL_SEGMENT_SIZE);
+
+    if ((segmentCount > 1) && (GetUnpackThreadCount() > 1))
+    {
+        // XChaCha20: subkey and nonce derived from key and nonce[24]
+        crypto_aead_ctx ctx = { 0 };
+        crypto_aead_init_x(&ctx, key, nonce);
+
+        // Poly1305 one-time key: first 32 bytes of ChaCha20 block at ctx.counter, data uses next blocks
+        uint8_t authKey[64] = { 0 };
+        crypto_chacha20_djb(authKey, NULL, 64, ctx.key, ctx.nonce, ctx.counter);
+
+        // Poly1305 MAC: data + padding (16 bytes alignment) + additional data size (0) + data size, little-endian
+        uint8_t padding[16] = { 0 };
+        uint8_t sizes[16] = { 0 };
+        for (int i = 0; i < 8; i++) sizes[8 + i] = (uint8_t)((unsigned long long)size >> (8*i));
+
+        uint8_t dataMac[16] = { 0 };
+        crypto_poly1305_ctx polyCtx = { 0 };
+        crypto_poly1305_init(&polyCtx, authKey);
+        crypto_poly1305_update(&polyCtx, data, size);
+        crypto_poly1305_update(&polyCtx, padding, (16 - size%16)%16);
+        crypto_poly1305_update(&polyCtx, sizes, 16);
+        crypto_poly1305_final(&polyCtx, dataMac);
+
+        if (crypto_verify16(mac, dataMac) == 0)
+        {
+            CipherSegments segments = { .data = data, .size = size, .key = ctx.key, .nonce = ctx.nonce, .counter = ctx.counter + 1 };
+            RunParallelJobs(ProcessChaCha20Segment, &segments, segmentCount);
+        }
+        else result = -1;
+
+        crypto_wipe(authKey, 64);
+        crypto_wipe(&ctx, sizeof(crypto_aead_ctx));
     }
+    else result = crypto_aead_unlock(data, mac, key, nonce, NULL, 0, data, size);
 
     return result;
 }
 
-//----------------------------------------------------------------------------------
-// Module Internal Functions Definition
-//----------------------------------------------------------------------------------
+// Parallel job: ChaCha20 keystream applied to one data segment
+static void ProcessChaCha20Segment(void *data, unsigned int index)
+{
+    CipherSegments *segments = (CipherSegments *)data;
+    size_t offset = (size_t)index*RRES_PARALLEL_SEGMENT_SIZE;
+    size_t size = ((segments->size - offset) < RRES_PARALLEL_SEGMENT_SIZE)? (segments->size - offset) : RRES_PARALLEL_SEGMENT_SIZE;
 
-// Load data chunk: RRES_DATA_LINK
-static void *LoadDataFromResourceLink(rresResourceChunk chunk, unsigned int *size)
+    crypto_chacha20_djb(segments->data + offset, segments->data + offset, size, segments->key, segments->nonce, segments->counter + offset/64);
+}
+
+// Load segmented cipher footer: salt, nonce and segments layout
+// NOTE: Footer is stored at the end of packed data: salt[16] + nonce[24] + segmentSize + dataSize,
+// segments layout is validated against packed data size, returns false if not valid
+static bool LoadAEADSegmentsFooter(AEADSegments *segments, unsigned char *salt, const unsigned char *footer, unsigned int packedSize)
 {
-    char fullFilePath[2048] = { 0 };
-    void *data = NULL;
-    *size = 0;
+    memcpy(salt, footer, 16);
+    memcpy(segments->nonce, footer + 16, 24);
+    memcpy(&segments->segmentSize, footer + 16 + 24, sizeof(unsigned int));
+    memcpy(&segments->dataSize, footer + 16 + 24 + 4, sizeof(unsigned int));
 
-    // Get external link filepath
-    char *linkFilePath = (char *)RL_CALLOC(chunk.data.props[0], 1);
-    if (linkFilePath != NULL) memcpy(linkFilePath, chunk.data.raw, chunk.data.props[0]);
+    if (segments->segmentSize == 0) return false;
 
-    // Get base directory to append filepath if not provided by user
-    if (baseDir == NULL) baseDir = GetApplicationDirectory();
+    // NOTE: Empty data is stored as one empty segment, MAC is still required
+    unsigned long long segmentCount = ((unsigned long long)segments->dataSize + segments->segmentSize - 1)/segments->segmentSize;
+    if (segmentCount == 0) segmentCount = 1;
+    segments->segmentCount = (unsigned int)segmentCount;
 
-    strcpy(fullFilePath, baseDir);
-    strcat(fullFilePath, linkFilePath);
+    return ((segments->dataSize + segmentCount*16 + CIPHER_SEGMENTS_FOOTER_SIZE) == packedSize);
+}
 
-    RRES_LOG("RRES: %c%c%c%c: Data file linked externally: %s\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3], linkFilePath);
+// Encrypt/decrypt segments in place (XChaCha20-Poly1305), from segments->first
+// NOTE: Large data is processed by segments in parallel, if any segment decryption fails
+// the already decrypted segments are encrypted again, so data is not modified
+static int ProcessAEADSegments(AEADSegments *segments, unsigned int count, bool decrypt)
+{
+    int result = 0;
 
-    if (FileExists(fullFilePath))
+    if (decrypt)
     {
-        // Load external file as raw data
-        // NOTE: We check if file is a text file to allow automatic line-endings processing
-        if (IsFileExtension(linkFilePath, ".txt;.md;.vs;.fs;.info;.c;.h;.json;.xml;.glsl"))     // Text file
+        segments->results = (int *)RL_CALLOC(count, sizeof(int));
+        if (segments->results == NULL) return -1;
+    }
+
+    // NOTE: Small data is always processed in calling thread, avoiding threads creation
+    if (((unsigned long long)count*segments->segmentSize) >= 2*RRES_PARALLEL_SEGMENT_SIZE) RunParallelJobs(ProcessAEADSegment, segments, count);
+    else for (unsigned int i = 0; i < count; i++) ProcessAEADSegment(segments, i);
+
+    if (decrypt)
+    {
+        for (unsigned int i = 0; i < count; i++) if (segments->results[i] != 0) result = -1;
+
+        if (result != 0)
         {
-            data = LoadFileText(fullFilePath);
-            *size = TextLength((char *)data);
+            int *results = segments->results;
+            segments->results = NULL;
+
+            // Restore decrypted segments, encryption is deterministic for same (key, nonce), MAC is not changed
+            for (unsigned int i = 0; i < count; i++) if (results[i] == 0) ProcessAEADSegment(segments, i);
+
+            segments->results = results;
         }
-        else data = LoadFileData(fullFilePath, (int *)size);
 
-        if ((data != NULL) && (*size > 0)) RRES_LOG("RRES: %c%c%c%c: External linked file loaded successfully\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+        RL_FREE(segments->results);
+        segments->results = NULL;
     }
-    else RRES_LOG("RRES: WARNING: [%s] Linked external file could not be found\n", linkFilePath);
 
-    return data;
+    return result;
 }
 
-// Load data chunk: RRES_DATA_RAW
-// NOTE: This chunk can be used raw files embedding or other binary blobs
-static void *LoadDataFromResourceChunk(rresResourceChunk chunk, unsigned int *size)
+// Parallel job: XChaCha20-Poly1305 applied to one data segment
+// NOTE: Segment nonce is the base nonce with segment index XORed into last 8 bytes (little-endian),
+// additional data authenticates segment index and total data size, segments can not be reordered or truncated
+static void ProcessAEADSegment(void *data, unsigned int index)
 {
-    void *rawData = NULL;
+    AEADSegments *segments = (AEADSegments *)data;
+    unsigned long long segment = (unsigned long long)segments->first + index;
+    unsigned long long offset = segment*segments->segmentSize;
+    size_t size = ((segments->dataSize - offset) < segments->segmentSize)? (size_t)(segments->dataSize - offset) : segments->segmentSize;
+    unsigned char *segmentData = segments->data + (size_t)index*segments->segmentSize;
 
-    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+    uint8_t nonce[24] = { 0 };
+    uint8_t ad[16] = { 0 };
+    memcpy(nonce, segments->nonce, 24);
+
+    for (int i = 0; i < 8; i++)
     {
-        rawData = RL_CALLOC(chunk.data.props[0], 1);
-        if (rawData != NULL) memcpy(rawData, chunk.data.raw, chunk.data.props[0]);
-        *size = chunk.data.props[0];
+        nonce[16 + i] ^= (uint8_t)(segment >> (8*i));
+        ad[i] = (uint8_t)(segment >> (8*i));
+        ad[8 + i] = (uint8_t)((unsigned long long)segments->dataSize >> (8*i));
     }
-    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
 
-    return rawData;
+    if (segments->results != NULL) segments->results[index] = crypto_aead_unlock(segmentData, segments->macs + (size_t)index*16, segments->key, nonce, ad, 16, segmentData, size);
+    else crypto_aead_lock(segmentData, segments->macs + (size_t)index*16, segments->key, nonce, ad, 16, segmentData, size);
 }
+#endif
 
-// Load data chunk: RRES_DATA_TEXT
-// NOTE: This chunk can be used for shaders or other text data elements (materials?)
-static char *LoadTextFromResourceChunk(rresResourceChunk chunk, unsigned int *codeLang)
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+// Encrypt/decrypt data in place (AES-CTR), from provided counter block
+// NOTE: Counter is a 128-bit big-endian block index, starting at 0 for data start (tiny-AES compatible),
+// AES hardware instructions are used if available, tiny-AES is used otherwise
+static void ProcessAES_CTR(const struct AES_ctx *ctx, unsigned char *data, size_t size, unsigned long long block)
 {
-    char *text = NULL;
+    if (aesHardware < 0) aesHardware = IsAESHardwareSupported()? 1 : 0;
 
-    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+#if defined(RRES_AES_HARDWARE_X86)
+    if (aesHardware == 1) { ProcessAES_CTR_NI(ctx, data, size, block); return; }
+#elif defined(RRES_AES_HARDWARE_ARM)
+    if (aesHardware == 1) { ProcessAES_CTR_ARMv8(ctx, data, size, block); return; }
+#endif
+
+    // Fallback: tiny-AES, counter must be set on a context copy
+    struct AES_ctx blockCtx = *ctx;
+    for (int i = 0; i < 8; i++) blockCtx.Iv[i] = 0;
+    for (int i = 0; i < 8; i++) blockCtx.Iv[8 + i] = (uint8_t)(block >> (56 - 8*i));
+
+    AES_CTR_xcrypt_buffer(&blockCtx, (uint8_t *)data, size);
+
+    crypto_wipe(&blockCtx, sizeof(struct AES_ctx));
+}
+
+// Encrypt/decrypt data in place (AES-CTR), computing plain data MD5 in the same pass
+// NOTE: Data is processed by tiles, MD5 is computed while tile data is still in cache:
+// decryption: MD5 of output data, encryption: MD5 of input data
+static void ProcessAES_CTR_MD5(const struct AES_ctx *ctx, unsigned char *data, size_t size, bool decrypt, unsigned char *md5)
+{
+    MD5Context md5Context = { 0 };
+    InitMD5(&md5Context);
+
+    unsigned int segmentCount = (unsigned int)((size + RRES_PARALLEL_SEGMENT_SIZE - 1)/RRES_PARALLEL_SEGMENT_SIZE);
+
+    if (decrypt && (segmentCount > 1) && (GetUnpackThreadCount() > 1))
     {
-        text = (char *)RL_CALLOC(chunk.data.props[0] + 1, 1);   // We add NULL terminator, just in case
-        if (text != NULL) memcpy(text, chunk.data.raw, chunk.data.props[0]);
+        // Large data: segments decrypted in parallel
+        // NOTE: MD5 can not be computed by segments, it's computed in a second pass over decrypted data
+        if (aesHardware < 0) aesHardware = IsAESHardwareSupported()? 1 : 0;
 
-        // TODO: We got some extra text properties, in case they could be useful for users:
-        // chunk.props[1]:rresTextEncoding, chunk.props[2]:rresCodeLang, chunk. props[3]:cultureCode
-        *codeLang = chunk.data.props[2];
-        //chunks.props[3]:cultureCode could be useful for localized text
+        CipherSegments segments = { .data = data, .size = size, .aesContext = ctx };
+        RunParallelJobs(ProcessAES_CTR_Segment, &segments, segmentCount);
+
+        UpdateMD5(&md5Context, data, size);
+        FinalMD5(&md5Context, md5);
+        return;
     }
-    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
 
-    return text;
+    for (size_t offset = 0; offset < size; offset += AES_CTR_TILE_SIZE)
+    {
+        size_t tileSize = ((size - offset) < AES_CTR_TILE_SIZE)? (size - offset) : AES_CTR_TILE_SIZE;
+
+        if (!decrypt) UpdateMD5(&md5Context, data + offset, tileSize);
+        ProcessAES_CTR(ctx, data + offset, tileSize, offset/AES_BLOCKLEN);
+        if (decrypt) UpdateMD5(&md5Context, data + offset, tileSize);
+    }
+
+    FinalMD5(&md5Context, md5);
 }
 
-// Load data chunk: RRES_DATA_IMAGE
-// NOTE: Many data types use images data in some way (font, material...)
-static Image LoadImageFromResourceChunk(rresResourceChunk chunk)
+// Parallel job: AES-CTR keystream applied to one data segment
+static void ProcessAES_CTR_Segment(void *data, unsigned int index)
 {
-    Image image = { 0 };
+    CipherSegments *segments = (CipherSegments *)data;
+    size_t offset = (size_t)index*RRES_PARALLEL_SEGMENT_SIZE;
+    size_t size = ((segments->size - offset) < RRES_PARALLEL_SEGMENT_SIZE)? (segments->size - offset) : RRES_PARALLEL_SEGMENT_SIZE;
 
-    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+    ProcessAES_CTR((const struct AES_ctx *)segments->aesContext, segments->data + offset, size, offset/AES_BLOCKLEN);
+}
+
+// Check AES hardware instructions support (runtime)
+static bool IsAESHardwareSupported(void)
+{
+    bool supported = false;
+
+#if defined(RRES_AES_HARDWARE_X86)
+    // CPUID leaf 1: ECX bit 25 (AES-NI)
+    #if defined(_MSC_VER)
+        int info[4] = { 0 };
+        __cpuid(info, 1);
+        supported = ((info[2] & (1 << 25)) != 0);
+    #else
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) supported = ((ecx & (1 << 25)) != 0);
+    #endif
+#elif defined(RRES_AES_HARDWARE_ARM)
+    #if defined(__APPLE__)
+        supported = true;       // All Apple ARMv8 CPUs support Crypto Extensions
+    #else
+        supported = ((getauxval(AT_HWCAP) & (1 << 3)) != 0);   // HWCAP_AES
+    #endif
+#endif
+
+    return supported;
+}
+
+#if defined(RRES_AES_HARDWARE_X86)
+// Get AES-CTR counter block for block index: 128-bit big-endian
+AES_HARDWARE_TARGET static __m128i GetCounterBlockNI(unsigned long long block)
+{
+    unsigned long long swapped = 0;
+    for (int i = 0; i < 8; i++) swapped |= ((block >> (8*i)) & 0xff) << (56 - 8*i);
+
+    return _mm_set_epi64x((long long)swapped, 0);
+}
+
+// AES-CTR using AES-NI instructions
+// NOTE: tiny-AES expanded key (ctx->RoundKey) is directly used, 4 blocks are processed in parallel
+AES_HARDWARE_TARGET static void ProcessAES_CTR_NI(const struct AES_ctx *ctx, unsigned char *data, size_t size, unsigned long long block)
+{
+    __m128i roundKeys[15] = { 0 };
+    for (int r = 0; r < 15; r++) roundKeys[r] = _mm_loadu_si128((const __m128i *)(ctx->RoundKey + 16*r));
+
+    size_t i = 0;
+
+    for (; (i + 64) <= size; i += 64, block += 4)
     {
-        image.width = chunk.data.props[0];
-        image.height = chunk.data.props[1];
-        int format = chunk.data.props[2];
+        __m128i b0 = _mm_xor_si128(GetCounterBlockNI(block), roundKeys[0]);
+        __m128i b1 = _mm_xor_si128(GetCounterBlockNI(block + 1), roundKeys[0]);
+        __m128i b2 = _mm_xor_si128(GetCounterBlockNI(block + 2), roundKeys[0]);
+        __m128i b3 = _mm_xor_si128(GetCounterBlockNI(block + 3), roundKeys[0]);
 
-        // Assign equivalent pixel formats for our engine
-        // NOTE: In this case rresPixelFormat defined values match raylib PixelFormat values
-        switch (format)
+        for (int r = 1; r < 14; r++)
         {
-            case RRES_PIXELFORMAT_UNCOMP_GRAYSCALE: image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE; break;
-            case RRES_PIXELFORMAT_UNCOMP_GRAY_ALPHA: image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA; break;
-            case RRES_PIXELFORMAT_UNCOMP_R5G6B5: image.format = PIXELFORMAT_UNCOMPRESSED_R5G6B5; break;
-            case RRES_PIXELFORMAT_UNCOMP_R8G8B8: image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8; break;
-            case RRES_PIXELFORMAT_UNCOMP_R5G5B5A1: image.format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1; break;
-            case RRES_PIXELFORMAT_UNCOMP_R4G4B4A4: image.format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4; break;
-            case RRES_PIXELFORMAT_UNCOMP_R8G8B8A8: image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8; break;
-            case RRES_PIXELFORMAT_UNCOMP_R32: image.format = PIXELFORMAT_UNCOMPRESSED_R32; break;
-            case RRES_PIXELFORMAT_UNCOMP_R32G32B32: image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32; break;
-            case RRES_PIXELFORMAT_UNCOMP_R32G32B32A32: image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32; break;
-            case RRES_PIXELFORMAT_COMP_DXT1_RGB: image.format = PIXELFORMAT_COMPRESSED_DXT1_RGB; break;
-            case RRES_PIXELFORMAT_COMP_DXT1_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_DXT3_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_DXT5_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_ETC1_RGB: image.format = PIXELFORMAT_COMPRESSED_ETC1_RGB; break;
-            case RRES_PIXELFORMAT_COMP_ETC2_RGB: image.format = PIXELFORMAT_COMPRESSED_ETC2_RGB; break;
-            case RRES_PIXELFORMAT_COMP_ETC2_EAC_RGBA: image.format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_PVRT_RGB: image.format = PIXELFORMAT_COMPRESSED_PVRT_RGB; break;
-            case RRES_PIXELFORMAT_COMP_PVRT_RGBA: image.format = PIXELFORMAT_COMPRESSED_PVRT_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_ASTC_4x4_RGBA: image.format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_ASTC_8x8_RGBA: image.format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA; break;
-            default: break;
+            b0 = _mm_aesenc_si128(b0, roundKeys[r]);
+            b1 = _mm_aesenc_si128(b1, roundKeys[r]);
+            b2 = _mm_aesenc_si128(b2, roundKeys[r]);
+            b3 = _mm_aesenc_si128(b3, roundKeys[r]);
         }
 
-        image.mipmaps = chunk.data.props[3];
+        b0 = _mm_aesenclast_si128(b0, roundKeys[14]);
+        b1 = _mm_aesenclast_si128(b1, roundKeys[14]);
+        b2 = _mm_aesenclast_si128(b2, roundKeys[14]);
+        b3 = _mm_aesenclast_si128(b3, roundKeys[14]);
 
-        // Image data size can be computed from image properties
-        unsigned int size = GetPixelDataSize(image.width, image.height, image.format);
+        _mm_storeu_si128((__m128i *)(data + i), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + i)), b0));
+        _mm_storeu_si128((__m128i *)(data + i + 16), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + i + 16)), b1));
+        _mm_storeu_si128((__m128i *)(data + i + 32), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + i + 32)), b2));
+        _mm_storeu_si128((__m128i *)(data + i + 48), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + i + 48)), b3));
+    }
+
+    // Remaining blocks, last one could be partial
+    for (; i < size; i += 16, block++)
+    {
+        __m128i b = _mm_xor_si128(GetCounterBlockNI(block), roundKeys[0]);
+        for (int r = 1; r < 14; r++) b = _mm_aesenc_si128(b, roundKeys[r]);
+        b = _mm_aesenclast_si128(b, roundKeys[14]);
+
+        unsigned char keyStream[16] = { 0 };
+        _mm_storeu_si128((__m128i *)keyStream, b);
+        for (size_t k = 0; (k < 16) && ((i + k) < size); k++) data[i + k] ^= keyStream[k];
+    }
+
+    crypto_wipe(roundKeys, sizeof(roundKeys));
+}
+#endif
+
+#if defined(RRES_AES_HARDWARE_ARM)
+// AES-CTR using ARMv8 Crypto Extensions
+// NOTE: tiny-AES expanded key (ctx->RoundKey) is directly used, AESE includes AddRoundKey before SubBytes/ShiftRows
+AES_HARDWARE_TARGET static void ProcessAES_CTR_ARMv8(const struct AES_ctx *ctx, unsigned char *data, size_t size, unsigned long long block)
+{
+    uint8x16_t roundKeys[15];
+    for (int r = 0; r < 15; r++) roundKeys[r] = vld1q_u8(ctx->RoundKey + 16*r);
 
-        // NOTE: Computed image data must match the data size of the chunk processed (minus propCount + props[4] size)
-        if (size == (chunk.info.baseSize - 20))
+    unsigned char counter[16] = { 0 };
+
+    for (size_t i = 0; i < size; i += 16, block++)
+    {
+        // Counter block: block index in big-endian, last 8 bytes
+        for (int k = 0; k < 8; k++) counter[8 + k] = (unsigned char)(block >> (56 - 8*k));
+
+        uint8x16_t b = vld1q_u8(counter);
+        for (int r = 0; r < 13; r++) b = vaesmcq_u8(vaeseq_u8(b, roundKeys[r]));
+        b = veorq_u8(vaeseq_u8(b, roundKeys[13]), roundKeys[14]);
+
+        if ((i + 16) <= size) vst1q_u8(data + i, veorq_u8(vld1q_u8(data + i), b));
+        else
         {
-            image.data = RL_CALLOC(size, 1);
-            if (image.data != NULL) memcpy(image.data, chunk.data.raw, size);
+            unsigned char keyStream[16] = { 0 };
+            vst1q_u8(keyStream, b);
+            for (size_t k = 0; (i + k) < size; k++) data[i + k] ^= keyStream[k];
         }
-        else RRES_LOG("RRES: WARNING: IMGE: Chunk data size do not match expected image data size\n");
     }
-    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
 
-    return image;
+    crypto_wipe(roundKeys, sizeof(roundKeys));
+}
+#endif
+
+// Init MD5 hash computation
+static void InitMD5(MD5Context *md5)
+{
+    md5->state[0] = 0x67452301;
+    md5->state[1] = 0xefcdab89;
+    md5->state[2] = 0x98badcfe;
+    md5->state[3] = 0x10325476;
+    md5->size = 0;
 }
 
-// Get file extension from RRES_DATA_RAW properties (unsigned int)
-static const char *GetExtensionFromProps(unsigned int ext01, unsigned int ext02)
+// Update MD5 hash with provided data
+static void UpdateMD5(MD5Context *md5, const unsigned char *data, size_t size)
 {
-    static char extension[8] = { 0 };
-    memset(extension, 0, 8);
+    unsigned int pending = (unsigned int)(md5->size%64);
+    md5->size += size;
 
-    // Convert file extension provided as 2 unsigned int properties, to a char[] array
-    // NOTE: Extension is defined as 2 unsigned int big-endian values (4 bytes each),
-    // starting with a dot, i.e 0x2e706e67 => ".png"
-    extension[0] = (unsigned char)((ext01 & 0xff000000) >> 24);
-    extension[1] = (unsigned char)((ext01 & 0x00ff0000) >> 16);
-    extension[2] = (unsigned char)((ext01 & 0x0000ff00) >> 8);
-    extension[3] = (unsigned char)(ext01 & 0x000000ff);
+    // Complete pending block first
+    if (pending > 0)
+    {
+        size_t fill = ((64 - pending) < size)? (64 - pending) : size;
+        memcpy(md5->buffer + pending, data, fill);
+        data += fill;
+        size -= fill;
 
-    extension[4] = (unsigned char)((ext02 & 0xff000000) >> 24);
-    extension[5] = (unsigned char)((ext02 & 0x00ff0000) >> 16);
-    extension[6] = (unsigned char)((ext02 & 0x0000ff00) >> 8);
-    extension[7] = (unsigned char)(ext02 & 0x000000ff);
+        if ((pending + fill) < 64) return;
+        ProcessMD5Block(md5->state, md5->buffer);
+    }
 
-    return extension;
+    for (; size >= 64; data += 64, size -= 64) ProcessMD5Block(md5->state, data);
+
+    if (size > 0) memcpy(md5->buffer, data, size);
+}
+
+// Finish MD5 hash computation, hash[16]
+static void FinalMD5(MD5Context *md5, unsigned char *hash)
+{
+    unsigned long long bitSize = md5->size*8;
+    unsigned int pending = (unsigned int)(md5->size%64);
+
+    // Padding: 0x80, zeros, data size in bits (little-endian, 64 bit)
+    unsigned char padding[72] = { 0x80 };
+    unsigned int paddingSize = (pending < 56)? (56 - pending) : (120 - pending);
+    for (int i = 0; i < 8; i++) padding[paddingSize + i] = (unsigned char)(bitSize >> (8*i));
+
+    UpdateMD5(md5, padding, paddingSize + 8);
+
+    for (int i = 0; i < 16; i++) hash[i] = (unsigned char)(md5->state[i/4] >> (8*(i%4)));
 }
 
+// Process one 64-byte block of MD5 data
+static void ProcessMD5Block(unsigned int *state, const unsigned char *block)
+{
+    #define MD5_F(x, y, z) (((x) & (y)) | (~(x) & (z)))
+    #define MD5_G(x, y, z) (((x) & (z)) | ((y) & ~(z)))
+    #define MD5_H(x, y, z) ((x) ^ (y) ^ (z))
+    #define MD5_I(x, y, z) ((y) ^ ((x) | ~(z)))
+    #define MD5_STEP(f, a, b, c, d, w, k, r) { a += MD5_##f(b, c, d) + (w) + (k); a = b + ((a << (r)) | (a >> (32 - (r)))); }
+
+    unsigned int w[16] = { 0 };
+    for (int i = 0; i < 16; i++) w[i] = block[4*i] | (block[4*i + 1] << 8) | (block[4*i + 2] << 16) | ((unsigned int)block[4*i + 3] << 24);
+
+    unsigned int a = state[0];
+    unsigned int b = state[1];
+    unsigned int c = state[2];
+    unsigned int d = state[3];
+
+    // Round 1
+    MD5_STEP(F, a, b, c, d, w[0], 0xd76aa478, 7);
+    MD5_STEP(F, d, a, b, c, w[1], 0xe8c7b756, 12);
+    MD5_STEP(F, c, d, a, b, w[2], 0x242070db, 17);
+    MD5_STEP(F, b, c, d, a, w[3], 0xc1bdceee, 22);
+    MD5_STEP(F, a, b, c, d, w[4], 0xf57c0faf, 7);
+    MD5_STEP(F, d, a, b, c, w[5], 0x4787c62a, 12);
+    MD5_STEP(F, c, d, a, b, w[6], 0xa8304613, 17);
+    MD5_STEP(F, b, c, d, a, w[7], 0xfd469501, 22);
+    MD5_STEP(F, a, b, c, d, w[8], 0x698098d8, 7);
+    MD5_STEP(F, d, a, b, c, w[9], 0x8b44f7af, 12);
+    MD5_STEP(F, c, d, a, b, w[10], 0xffff5bb1, 17);
+    MD5_STEP(F, b, c, d, a, w[11], 0x895cd7be, 22);
+    MD5_STEP(F, a, b, c, d, w[12], 0x6b901122, 7);
+    MD5_STEP(F, d, a, b, c, w[13], 0xfd987193, 12);
+    MD5_STEP(F, c, d, a, b, w[14], 0xa679438e, 17);
+    MD5_STEP(F, b, c, d, a, w[15], 0x49b40821, 22);
+
+    // Round 2
+    MD5_STEP(G, a, b, c, d, w[1], 0xf61e2562, 5);
+    MD5_STEP(G, d, a, b, c, w[6], 0xc040b340, 9);
+    MD5_STEP(G, c, d, a, b, w[11], 0x265e5a51, 14);
+    MD5_STEP(G, b, c, d, a, w[0], 0xe9b6c7aa, 20);
+    MD5_STEP(G, a, b, c, d, w[5], 0xd62f105d, 5);
+    MD5_STEP(G, d, a, b, c, w[10], 0x02441453, 9);
+    MD5_STEP(G, c, d, a, b, w[15], 0xd8a1e681, 14);
+    MD5_STEP(G, b, c, d, a, w[4], 0xe7d3fbc8, 20);
+    MD5_STEP(G, a, b, c, d, w[9], 0x21e1cde6, 5);
+    MD5_STEP(G, d, a, b, c, w[14], 0xc33707d6, 9);
+    MD5_STEP(G, c, d, a, b, w[3], 0xf4d50d87, 14);
+    MD5_STEP(G, b, c, d, a, w[8], 0x455a14ed, 20);
+    MD5_STEP(G, a, b, c, d, w[13], 0xa9e3e905, 5);
+    MD5_STEP(G, d, a, b, c, w[2], 0xfcefa3f8, 9);
+    MD5_STEP(G, c, d, a, b, w[7], 0x676f02d9, 14);
+    MD5_STEP(G, b, c, d, a, w[12], 0x8d2a4c8a, 20);
+
+    // Round 3
+    MD5_STEP(H, a, b, c, d, w[5], 0xfffa3942, 4);
+    MD5_STEP(H, d, a, b, c, w[8], 0x8771f681, 11);
+    MD5_STEP(H, c, d, a, b, w[11], 0x6d9d6122, 16);
+    MD5_STEP(H, b, c, d, a, w[14], 0xfde5380c, 23);
+    MD5_STEP(H, a, b, c, d, w[1], 0xa4beea44, 4);
+    MD5_STEP(H, d, a, b, c, w[4], 0x4bdecfa9, 11);
+    MD5_STEP(H, c, d, a, b, w[7], 0xf6bb4b60, 16);
+    MD5_STEP(H, b, c, d, a, w[10], 0xbebfbc70, 23);
+    MD5_STEP(H, a, b, c, d, w[13], 0x289b7ec6, 4);
+    MD5_STEP(H, d, a, b, c, w[0], 0xeaa127fa, 11);
+    MD5_STEP(H, c, d, a, b, w[3], 0xd4ef3085, 16);
+    MD5_STEP(H, b, c, d, a, w[6], 0x04881d05, 23);
+    MD5_STEP(H, a, b, c, d, w[9], 0xd9d4d039, 4);
+    MD5_STEP(H, d, a, b, c, w[12], 0xe6db99e5, 11);
+    MD5_STEP(H, c, d, a, b, w[15], 0x1fa27cf8, 16);
+    MD5_STEP(H, b, c, d, a, w[2], 0xc4ac5665, 23);
+
+    // Round 4
+    MD5_STEP(I, a, b, c, d, w[0], 0xf4292244, 6);
+    MD5_STEP(I, d, a, b, c, w[7], 0x432aff97, 10);
+    MD5_STEP(I, c, d, a, b, w[14], 0xab9423a7, 15);
+    MD5_STEP(I, b, c, d, a, w[5], 0xfc93a039, 21);
+    MD5_STEP(I, a, b, c, d, w[12], 0x655b59c3, 6);
+    MD5_STEP(I, d, a, b, c, w[3], 0x8f0ccc92, 10);
+    MD5_STEP(I, c, d, a, b, w[10], 0xffeff47d, 15);
+    MD5_STEP(I, b, c, d, a, w[1], 0x85845dd1, 21);
+    MD5_STEP(I, a, b, c, d, w[8], 0x6fa87e4f, 6);
+    MD5_STEP(I, d, a, b, c, w[15], 0xfe2ce6e0, 10);
+    MD5_STEP(I, c, d, a, b, w[6], 0xa3014314, 15);
+    MD5_STEP(I, b, c, d, a, w[13], 0x4e0811a1, 21);
+    MD5_STEP(I, a, b, c, d, w[4], 0xf7537e82, 6);
+    MD5_STEP(I, d, a, b, c, w[11], 0xbd3af235, 10);
+    MD5_STEP(I, c, d, a, b, w[2], 0x2ad7d2bb, 15);
+    MD5_STEP(I, b, c, d, a, w[9], 0xeb86d391, 21);
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+
+    #undef MD5_F
+    #undef MD5_G
+    #undef MD5_H
+    #undef MD5_I
+    #undef MD5_STEP
+}
+#endif
+
 #endif // RRES_RAYLIB_IMPLEMENTATION
@@ -9,6 +9,17 @@
 *       If not defined, the library is in header only mode and can be included in other headers
 *       or source files without problems. But only ONE file should hold the implementation
 *
+*   #define RRES_SUPPORT_STATS
+*       Enable loading stats recording: file access, CRC32, key derivation, decryption, decompression
+*       and memory allocations counters and timings, stats can be retrieved with rresGetStats()
+*       NOTE: It must be defined in every file including rres.h, if not defined stats recording compiles to nothing
+*
+*   #define RRES_SUPPORT_TRACE
+*       Enable loading trace spans recording: file open, chunk lookup, data read, CRC32, decryption,
+*       decompression and format conversion, with thread id and chunk id/type, spans are provided to a
+*       user callback and/or written to a Chrome trace JSON file (chrome://tracing, Perfetto)
+*       NOTE: It must be defined in every file including rres.h, if not defined trace recording compiles to nothing
+*
 *   FEATURES:
 *
 *     - Multi-resource files: Some files could end-up generating multiple connected resources in
@@ -102,6 +113,7 @@
 *                 NOTE: Allocators can be redefined with macros RRES_MALLOC, RRES_CALLOC, RRES_FREE
 *     - stdio.h:  Required for file access functionality: FILE, fopen(), fseek(), fread(), fclose()
 *     - string.h: Required for memory data management: memcpy(), memcmp()
+*     - fcntl.h:  Required on POSIX systems for file cache hints: posix_fadvise(), fcntl()
 *
 *   VERSION HISTORY:
 *
@@ -170,12 +182,47 @@
 #endif
 
 // Simple log system to avoid printf() calls if required
-// NOTE: Avoiding those calls, also avoids const strings memory usage
-#define RRES_SUPPORT_LOG_INFO
-#if defined(RRES_SUPPORT_LOG_INFO)
-    #define RRES_LOG(...) printf(__VA_ARGS__)
+// NOTE: Avoiding those calls, also avoids const strings memory usage,
+// a custom RRES_LOG() can also be defined before including rres.h
+#ifndef RRES_LOG
+    #define RRES_SUPPORT_LOG_INFO
+    #if defined(RRES_SUPPORT_LOG_INFO)
+        #define RRES_LOG(...) printf(__VA_ARGS__)
+    #else
+        #define RRES_LOG(...)
+    #endif
+#endif
+
+// Loading stats recording
+// NOTE: Engine libraries can also record their own processing stats (decryption, decompression...)
+#if defined(RRES_SUPPORT_STATS)
+    #define RRES_STATS_BEGIN(timer)                 unsigned long long timer = rresGetTimeNs()
+    #define RRES_STATS_END(event, type, timer)      rresRecordStats(event, type, 0, rresGetTimeNs() - (timer))
+    #define RRES_STATS_RECORD(event, type, bytes)   rresRecordStats(event, type, bytes, 0)
 #else
-    #define RRES_LOG(...)
+    #define RRES_STATS_BEGIN(timer)
+    #define RRES_STATS_END(event, type, timer)
+    #define RRES_STATS_RECORD(event, type, bytes)
+#endif
+
+// Loading trace spans recording
+// NOTE: Engine libraries can also record their own processing spans (decryption, decompression, conversion)
+#if defined(RRES_SUPPORT_TRACE)
+    #define RRES_TRACE_BEGIN(span)                  unsigned long long span = rresGetTimeNs()
+    #define RRES_TRACE_END(stage, id, type, span)   rresRecordTraceSpan(stage, id, type, span, rresGetTimeNs())
+#else
+    #define RRES_TRACE_BEGIN(span)
+    #define RRES_TRACE_END(stage, id, type, span)
+#endif
+
+// Max number of rres files with individual loading stats
+#ifndef RRES_STATS_MAX_FILES
+    #define RRES_STATS_MAX_FILES        8
+#endif
+
+// Max size of rres files prefetched whole, larger files are scanned to prefetch only requested chunks
+#ifndef RRES_PREFETCH_FILE_MAX_SIZE
+    #define RRES_PREFETCH_FILE_MAX_SIZE (16*1024*1024)
 #endif
 
 // On Windows, MAX_PATH is limited to 256 by default,
@@ -228,6 +275,46 @@ typedef struct rresResourceMulti {
     rresResourceChunk *chunks;      // Resource chunks
 } rresResourceMulti;
 
+// rres loading stats
+// NOTE 1: Stats are recorded globally and per rres file, per file stats only include
+// the processing done by rres.h (file access, CRC32, memory), engine libraries processing
+// (decryption, decompression) is not related to a file and it's only recorded globally
+// NOTE 2: Memory usage (usedBytes, peakBytes) considers memory freed on resources unloading,
+// not related to a file, so it's only meaningful for global stats
+typedef struct rresStats {
+    unsigned long long readBytes;   // Data read from file (bytes)
+    unsigned long long readTime;    // Data read from file time (nanoseconds)
+    unsigned int readCount;         // File read calls
+    unsigned int seekCount;         // File seek calls
+    unsigned long long seekTime;    // File seek time (nanoseconds)
+    unsigned int crcCount;          // CRC32 data validations
+    unsigned long long crcTime;     // CRC32 data validation time (nanoseconds)
+    unsigned int keyCount;          // Cipher key derivations (key stretching)
+    unsigned long long keyTime;     // Cipher key derivation time (nanoseconds)
+    unsigned int decryptCount[256]; // Data decryptions, per rresEncryptionType
+    unsigned long long decryptTime[256];    // Data decryption time (nanoseconds), per rresEncryptionType
+    unsigned int decompressCount[256];      // Data decompressions, per rresCompressionType
+    unsigned long long decompressTime[256]; // Data decompression time (nanoseconds), per rresCompressionType
+    unsigned int allocCount;        // Memory allocations
+    unsigned long long allocBytes;  // Memory allocated (bytes)
+    unsigned long long usedBytes;   // Memory currently in use (bytes)
+    unsigned long long peakBytes;   // Memory peak usage (bytes)
+} rresStats;
+
+// rres loading trace span
+// NOTE: Spans are only recorded if RRES_SUPPORT_TRACE is defined
+typedef struct rresTraceSpan {
+    int stage;                      // Loading stage (rresTraceStage)
+    unsigned int threadId;          // Thread id that processed the stage
+    unsigned int rresId;            // Resource id processed (requested id for file open)
+    unsigned char type[4];          // Resource chunk type (FourCC), zeroed if not available
+    unsigned long long start;       // Stage start time (nanoseconds)
+    unsigned long long duration;    // Stage duration (nanoseconds)
+} rresTraceSpan;
+
+// rres loading trace callback, called on every span recorded
+typedef void (*rresTraceCallback)(const rresTraceSpan *span, void *userData);
+
 // Useful data types for specific chunk types
 //----------------------------------------------------------------------
 // CDIR: rres central directory entry
@@ -309,6 +396,14 @@ typedef enum rresResourceDataType {
                                             //    props[2]:componentCount
                                             //    props[3]:rresVertexFormat
                                             //    data: vertex
+                                            // NOTE: Quantized vertex data (HFLOAT, SHORT: snorm16, USHORT: unorm16), 4 + 2*componentCount properties (optional)
+                                            //    props[4 + c]:scale (float bits), props[4 + componentCount + c]:offset (float bits)
+                                            //    value = normalized*scale + offset (no properties: scale = 1.0f, offset = 0.0f)
+                                            // NOTE: Interleaved vertex data (RRES_VERTEX_ATTRIBUTE_INTERLEAVED), 4 + 4*attributeCount properties
+                                            //    props[2]:attributeCount
+                                            //    props[3]:stride (bytes)
+                                            //    props[4 + 4*i]:rresVertexAttribute, componentCount, rresVertexFormat, offset (bytes)
+                                            //    data: vertex (vertexCount*stride)
     RRES_DATA_FONT_GLYPHS  = 6,             // FourCC: FNTG - Font glyphs info data, 4 properties
                                             //    props[0]:baseSize
                                             //    props[1]:glyphCount
@@ -321,6 +416,9 @@ typedef enum rresResourceDataType {
     RRES_DATA_DIRECTORY    = 100,           // FourCC: CDIR - Central directory for input files
                                             //    props[0]:entryCount, 1 property
                                             //    data: rresDirEntry[0..entryCount]
+    RRES_DATA_DICTIONARY   = 101,           // FourCC: DICT - Compression dictionary shared by resource chunks in the file, 1 property
+                                            //    props[0]:size (bytes)
+                                            //    data: dictionary data (not compressed), chunk id: CRC32 of dictionary data
 
     // TODO: 2.0: Support resource package types (muti-resource)
     // NOTE: They contains multiple rresResourceChunk in rresResourceData.raw
@@ -345,6 +443,7 @@ typedef enum rresCompressionType {
     RRES_COMP_LZ4           = 20,           // LZ4 compression
     RRES_COMP_LZMA2         = 30,           // LZMA2 compression
     RRES_COMP_QOI           = 40,           // QOI compression, useful for RGB(A) image data
+    RRES_COMP_INDEX_DELTA   = 50,           // Index data compression (delta + zigzag + varint), useful for VRTX index data
     // TODO: Add additional compression algorithms if required
 } rresCompressionType;
 
@@ -370,9 +469,50 @@ typedef enum rresEncryptionType {
     RRES_CIPHER_CHACHA20    = 71,           // CHACHA20 encryption
     RRES_CIPHER_XCHACHA20   = 72,           // XCHACHA20 encryption
     RRES_CIPHER_XCHACHA20_POLY1305 = 73,    // XCHACHA20 with POLY1305 for message authentification (MAC)
+    RRES_CIPHER_XCHACHA20_POLY1305_SEGMENTED = 74, // XCHACHA20-POLY1305 by segments, every segment with its own MAC (random access)
     // TODO: Add additional encryption algorithm if required
 } rresEncryptionType;
 
+// Resource chunk data flags
+// Value required by rresResourceChunkInfo.flags
+// NOTE 1: Flags describe packed data layout, the engine-specific library is responsible to implement them
+// NOTE 2: Data filters are applied to raw data (props not filtered) before compression, undone after decompression
+typedef enum rresDataFlags {
+    RRES_FLAG_COMP_BLOCKS     = 0x0001,     // Data compressed in independent blocks, blocks index stored before blocks data
+    RRES_FLAG_COMP_DICTIONARY = 0x0002,     // Data compressed with a dictionary (DICT chunk), dictionary id stored after compressed data
+    RRES_FLAG_FILTER_SHUFFLE  = 0x0004,     // Data filtered before compression: element bytes shuffled (one plane per element byte)
+    RRES_FLAG_FILTER_DELTA    = 0x0008,     // Data filtered before compression: elements delta encoded (difference with previous element)
+    RRES_FLAG_FILTER_XOR      = 0x0010,     // Data filtered before compression: elements XOR with previous element (float data)
+    RRES_FLAG_FILTER_ELEMENT_2 = 0x0020,    // Data filter element size: 2 bytes (1 byte if no element size flag)
+    RRES_FLAG_FILTER_ELEMENT_4 = 0x0040,    // Data filter element size: 4 bytes
+    RRES_FLAG_FILTER_ELEMENT_8 = 0x0060,    // Data filter element size: 8 bytes
+    RRES_FLAG_FILTER_DISTANCE = 0x0100,     // Data filter previous element distance: (distance - 1)*RRES_FLAG_FILTER_DISTANCE, 1..16 elements (bits 8..11)
+    // TODO: Add additional data flags if required
+} rresDataFlags;
+
+// rres loading stats events, recorded with rresRecordStats()
+typedef enum rresStatsEvent {
+    RRES_STATS_EVENT_READ = 0,              // File data read, bytes + time
+    RRES_STATS_EVENT_SEEK,                  // File seek, time
+    RRES_STATS_EVENT_CRC,                   // CRC32 data validation, time
+    RRES_STATS_EVENT_KEY,                   // Cipher key derivation, time
+    RRES_STATS_EVENT_DECRYPT,               // Data decryption, type: rresEncryptionType, time
+    RRES_STATS_EVENT_DECOMPRESS,            // Data decompression, type: rresCompressionType, time
+    RRES_STATS_EVENT_ALLOC,                 // Memory allocation, bytes
+    RRES_STATS_EVENT_FREE,                  // Memory deallocation, bytes
+} rresStatsEvent;
+
+// rres loading trace stages, recorded with rresRecordTraceSpan()
+typedef enum rresTraceStage {
+    RRES_TRACE_OPEN = 0,                    // File open and header read
+    RRES_TRACE_INDEX,                       // Resource chunk lookup, chunks info scanning
+    RRES_TRACE_READ,                        // Resource chunk data read
+    RRES_TRACE_CRC,                         // CRC32 data validation
+    RRES_TRACE_DECRYPT,                     // Data decryption (including key derivation)
+    RRES_TRACE_DECOMPRESS,                  // Data decompression
+    RRES_TRACE_CONVERT,                     // Data conversion to engine format
+} rresTraceStage;
+
 // TODO: rres error codes (not used at this moment)
 // NOTE: Error codes when processing rres files
 typedef enum rresErrorType {
@@ -453,6 +593,7 @@ typedef enum rresVertexAttribute {
     RRES_VERTEX_ATTRIBUTE_TANGENT    = 30,  // Vertex tangent attribute: [x, y, z, w]
     RRES_VERTEX_ATTRIBUTE_COLOR      = 40,  // Vertex color attribute: [r, g, b, a]
     RRES_VERTEX_ATTRIBUTE_INDEX      = 100, // Vertex index attribute: [i]
+    RRES_VERTEX_ATTRIBUTE_INTERLEAVED = 200, // Vertex attributes interleaved: [attribute0, attribute1...], attributes described in props
     // TODO: Add additional attributes if required
 } rresVertexAttribute;
 
@@ -502,14 +643,40 @@ RRESAPI void rresUnloadResourceMulti(rresResourceMulti multi);
 RRESAPI rresResourceChunkInfo rresLoadResourceChunkInfo(const char *fileName, unsigned int rresId);  // Load resource chunk info for provided id
 RRESAPI rresResourceChunkInfo *rresLoadResourceChunkInfoAll(const char *fileName, unsigned int *chunkCount); // Load all resource chunks info
 
+// Read resource chunk packed data range from file, data is not processed
+// NOTE: Useful to read only the required part of large resource chunks (i.e. streaming), offset is relative
+// to chunk data start, CRC32 can not be verified on partial reads, it's up to the user library to verify data
+RRESAPI unsigned int rresReadResourceChunkRange(const char *fileName, unsigned int rresId, unsigned int offset, unsigned int size, void *buffer); // Read resource chunk data range, returns bytes read
+
 RRESAPI rresCentralDir rresLoadCentralDirectory(const char *fileName);              // Load central directory resource chunk from file
 RRESAPI void rresUnloadCentralDirectory(rresCentralDir dir);                        // Unload central directory resource chunk
 
+// Prefetch resource(s) data into system file cache
+// NOTE: Useful to warm-up the file cache in advance for resources that will be loaded soon (i.e. next level resources),
+// it just issues a read-ahead hint to the OS for the requested chunks (whole file if small or rresIds is NULL),
+// later rresLoadResourceChunk() is still required
+RRESAPI int rresPrefetch(const char *fileName, const unsigned int *rresIds, unsigned int count); // Prefetch resources for provided ids (NULL: whole file), returns chunks prefetched
+
 RRESAPI unsigned int rresGetDataType(const unsigned char *fourCC);                  // Get rresResourceDataType from FourCC code
 RRESAPI unsigned int rresGetResourceId(rresCentralDir dir, const char *fileName);            // Get resource id for a provided filename
                                                                                     // NOTE: It requires CDIR available in the file (it's optinal by design)
 RRESAPI unsigned int rresComputeCRC32(const unsigned char *data, int len);          // Compute CRC32 for provided data
 
+// Loading stats, only recorded if RRES_SUPPORT_STATS is defined
+RRESAPI rresStats rresGetStats(void);                                 // Get loading stats, global
+RRESAPI rresStats rresGetFileStats(const char *fileName);             // Get loading stats for a rres file
+RRESAPI void rresResetStats(void);                                    // Reset loading stats, global and per file
+RRESAPI void rresRecordStats(int event, unsigned int type, unsigned long long bytes, unsigned long long time); // Record loading stats event (rresStatsEvent)
+RRESAPI unsigned long long rresGetTimeNs(void);                       // Get current monotonic time in nanoseconds
+
+// Loading trace spans, only recorded if RRES_SUPPORT_TRACE is defined
+// NOTE: Spans are provided to the trace callback (if set) and written to the trace file (if opened),
+// trace file is written in Chrome trace event format (JSON), it can be opened with chrome://tracing or Perfetto
+RRESAPI void rresSetTraceCallback(rresTraceCallback callback, void *userData); // Set trace callback to receive loading spans
+RRESAPI int rresBeginTraceFile(const char *fileName);                 // Begin writing loading spans to trace file (Chrome trace JSON), returns 0 on failure
+RRESAPI void rresEndTraceFile(void);                                  // End writing loading spans to trace file
+RRESAPI void rresRecordTraceSpan(int stage, unsigned int rresId, const unsigned char *type, unsigned long long start, unsigned long long end); // Record loading trace span (rresTraceStage)
+
 // Manage password for data encryption/decryption
 // NOTE: The cipher password is kept as an internal pointer to provided string, it's up to the user to manage that sensible data properly
 // Password should be to allocate and set before loading an encrypted resource and it should be cleaned/wiped after the encrypted resource has been loaded
@@ -531,6 +698,14 @@ RRESAPI const char *rresGetCipherPassword(void);                      // Get pas
 
 #if defined(RRES_IMPLEMENTATION)
 
+// POSIX.1-2001 definitions, required for: posix_fadvise(), clock_gettime()
+// NOTE: Only required on strict ISO C modes (i.e. -std=c99), only effective if rres implementation is
+// included before any system header; macOS is excluded, defining it hides fcntl(F_RDADVISE)
+#if defined(__STRICT_ANSI__) && !defined(_WIN32) && !defined(__APPLE__) && \
+    !defined(_POSIX_C_SOURCE) && !defined(_XOPEN_SOURCE) && !defined(_GNU_SOURCE) && !defined(_DEFAULT_SOURCE)
+    #define _POSIX_C_SOURCE 200112L
+#endif
+
 // Boolean type
 #if (defined(__STDC__) && __STDC_VERSION__ >= 199901L) || (defined(_MSC_VER) && _MSC_VER >= 1800)
     #include <stdbool.h>
@@ -541,29 +716,116 @@ RRESAPI const char *rresGetCipherPassword(void);                      // Get pas
 
 #include <stdlib.h>                 // Required for: malloc(), calloc(), free()
 #include <stdio.h>                  // Required for: FILE, fopen(), fseek(), fread(), fclose()
-#include <string.h>                 // Required for: memcpy(), memcmp()
+#include <string.h>                 // Required for: memcpy(), memcmp(), strcmp()
+
+#if defined(__unix__) || defined(__unix) || defined(__APPLE__)
+    #include <fcntl.h>              // Required for: posix_fadvise(), fcntl()
+#endif
+
+#include <time.h>                   // Required for: clock_gettime(), clock()
+
+#if !defined(_WIN32)
+    #include <sys/time.h>           // Required for: gettimeofday()
+#endif
+
+#if defined(RRES_SUPPORT_TRACE) && !defined(_WIN32)
+    #include <pthread.h>            // Required for: pthread_self()
+#endif
+
+#if defined(_WIN32)
+    // Functions required to query time and thread id on Windows
+    // NOTE: Declared here to avoid including windows.h,
+    // windows.h declarations and types are used if it was already included
+    #if defined(_WINDOWS_)
+        typedef LARGE_INTEGER PerformanceCounter;
+    #else
+        typedef union { long long int QuadPart; } PerformanceCounter; // Matches LARGE_INTEGER
+
+        #if defined(__cplusplus)
+        extern "C" {
+        #endif
+        __declspec(dllimport) int __stdcall QueryPerformanceCounter(PerformanceCounter *lpPerformanceCount);
+        __declspec(dllimport) int __stdcall QueryPerformanceFrequency(PerformanceCounter *lpFrequency);
+        #if defined(RRES_SUPPORT_TRACE)
+        __declspec(dllimport) unsigned long __stdcall GetCurrentThreadId(void);
+        #endif
+        #if defined(__cplusplus)
+        }
+        #endif
+    #endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-//...
+// File cache hints, only available on some platforms
+// NOTE: posix_fadvise() requires POSIX.1-2001 definitions (_POSIX_C_SOURCE >= 200112L), on macOS the
+// equivalent fcntl(F_RDADVISE) is used, prefetch is disabled (no hint) if none of them is available
+#if defined(POSIX_FADV_WILLNEED)
+    #define RRES_PREFETCH_FADVISE
+#elif defined(F_RDADVISE)
+    #define RRES_PREFETCH_RDADVISE
+#endif
+
+// File access, recording loading stats if required
+#if defined(RRES_SUPPORT_STATS)
+    #define RRES_FREAD(ptr, size, count, file)  rresReadFile(ptr, size, count, file)
+    #define RRES_FSEEK(file, offset, origin)    rresSeekFile(file, offset, origin)
+    #define RRES_STATS_FILE(fileName)           rresSetStatsFile(fileName)
+#else
+    #define RRES_FREAD(ptr, size, count, file)  fread(ptr, size, count, file)
+    #define RRES_FSEEK(file, offset, origin)    fseek(file, offset, origin)
+    #define RRES_STATS_FILE(fileName)
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// rres file loading stats
+typedef struct rresFileStats {
+    bool used;                      // Stats slot in use
+    unsigned int fileId;            // File identifier (fileName CRC32 hash)
+    char *fileName;                 // File name copy, required to identify file on hash match
+    rresStats stats;                // File loading stats
+} rresFileStats;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 static const char *password = NULL;     // Password pointer, managed by user libraries
 
+#if defined(RRES_SUPPORT_STATS)
+static rresStats stats = { 0 };                             // Loading stats, global
+static rresFileStats fileStats[RRES_STATS_MAX_FILES] = { 0 }; // Loading stats, per file
+static rresStats *currentFileStats = NULL;                  // Loading stats for file currently processed
+#endif
+
+#if defined(RRES_SUPPORT_TRACE)
+static rresTraceCallback traceCallback = NULL;              // Loading trace callback
+static void *traceUserData = NULL;                          // Loading trace callback user data
+static FILE *traceFile = NULL;                              // Loading trace file (Chrome trace JSON)
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
 // Load resource chunk packed data into our data struct
 static rresResourceChunkData rresLoadResourceChunkData(rresResourceChunkInfo info, void *packedData);
 
+// Issue a read-ahead hint to the OS for a file data range
+static void rresPrefetchFileRange(FILE *file, long offset, long size);
+
+#if defined(RRES_SUPPORT_STATS)
+static size_t rresReadFile(void *buffer, size_t size, size_t count, FILE *file);    // Read data from file, recording stats
+static int rresSeekFile(FILE *file, long offset, int origin);                       // Seek file position, recording stats
+static void rresSetStatsFile(const char *fileName);                                 // Set file to record loading stats (NULL to stop)
+static void rresAddStats(rresStats *st, int event, unsigned int type, unsigned long long bytes, unsigned long long time); // Add event to stats
+#endif
+
+#if defined(RRES_SUPPORT_TRACE)
+static unsigned int rresGetThreadId(void);                                          // Get current thread id
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -572,22 +834,27 @@ rresResourceChunk rresLoadResourceChunk(const char *fileName, unsigned int rresI
 {
     rresResourceChunk chunk = { 0 };
 
+    RRES_TRACE_BEGIN(openSpan);
     FILE *rresFile = fopen(fileName, "rb");
 
     if (rresFile == NULL) RRES_LOG("RRES: WARNING: [%s] rres file could not be opened\n", fileName);
     else
     {
+        RRES_STATS_FILE(fileName);
+
         RRES_LOG("RRES: INFO: Loading resource from file: %s\n", fileName);
 
         rresFileHeader header = { 0 };
 
         // Read rres file header
-        fread(&header, sizeof(rresFileHeader), 1, rresFile);
+        RRES_FREAD(&header, sizeof(rresFileHeader), 1, rresFile);
+        RRES_TRACE_END(RRES_TRACE_OPEN, rresId, NULL, openSpan);
 
         // Verify file signature: "rres" and file version: 100
         if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
         {
             bool found = false;
+            RRES_TRACE_BEGIN(indexSpan);
 
             // Check all available chunks looking for the requested id
             for (int i = 0; i < header.chunkCount; i++)
@@ -595,12 +862,13 @@ rresResourceChunk rresLoadResourceChunk(const char *fileName, unsigned int rresI
                 rresResourceChunkInfo info = { 0 };
 
                 // Read resource info header
-                fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
+                RRES_FREAD(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
 
                 // Check if resource id is the requested one
                 if (info.id == rresId)
                 {
                     found = true;
+                    RRES_TRACE_END(RRES_TRACE_INDEX, rresId, info.type, indexSpan);
 
                     RRES_LOG("RRES: INFO: Found requested resource id: 0x%08x\n", info.id);
                     RRES_LOG("RRES: %c%c%c%c: Id: 0x%08x | Base size: %i | Packed size: %i\n", info.type[0], info.type[1], info.type[2], info.type[3], info.id, info.baseSize, info.packedSize);
@@ -628,28 +896,37 @@ rresResourceChunk rresLoadResourceChunk(const char *fileName, unsigned int rresI
 
                     // Read and resource chunk from file data
                     // NOTE: Read data can be compressed/encrypted, it's up to the user library to manage decompression/decryption
+                    RRES_TRACE_BEGIN(readSpan);
                     void *data = RRES_CALLOC(info.packedSize, 1); // Allocate enough memory to store resource data chunk
-                    fread(data, info.packedSize, 1, rresFile);    // Read data: propsCount + props[] + data (+additional_data)
+                    RRES_STATS_RECORD(RRES_STATS_EVENT_ALLOC, 0, info.packedSize);
+                    RRES_FREAD(data, info.packedSize, 1, rresFile);    // Read data: propsCount + props[] + data (+additional_data)
+                    RRES_TRACE_END(RRES_TRACE_READ, info.id, info.type, readSpan);
 
                     // Get chunk.data properly organized (only if uncompressed/unencrypted)
                     chunk.data = rresLoadResourceChunkData(info, data);
                     chunk.info = info;
 
                     RRES_FREE(data);
+                    RRES_STATS_RECORD(RRES_STATS_EVENT_FREE, 0, info.packedSize);
 
                     break;      // Resource id found and loaded, stop checking the file
                 }
                 else
                 {
                     // Skip required data size to read next resource info header
-                    fseek(rresFile, info.packedSize, SEEK_CUR);
+                    RRES_FSEEK(rresFile, info.packedSize, SEEK_CUR);
                 }
             }
 
-            if (!found) RRES_LOG("RRES: WARNING: Requested resource not found: 0x%08x\n", rresId);
+            if (!found)
+            {
+                RRES_TRACE_END(RRES_TRACE_INDEX, rresId, NULL, indexSpan);
+                RRES_LOG("RRES: WARNING: Requested resource not found: 0x%08x\n", rresId);
+            }
         }
         else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
 
+        RRES_STATS_FILE(NULL);
         fclose(rresFile);
     }
 
@@ -659,6 +936,10 @@ rresResourceChunk rresLoadResourceChunk(const char *fileName, unsigned int rresI
 // Unload resource chunk from memory
 void rresUnloadResourceChunk(rresResourceChunk chunk)
 {
+    // NOTE: Packed data (compressed/encrypted) is kept in chunk.data.raw with no props,
+    // unpacked data size can be computed from base size: propCount + props[] + data
+    RRES_STATS_RECORD(RRES_STATS_EVENT_FREE, 0, (chunk.data.props == NULL)? chunk.info.packedSize : (chunk.info.baseSize - sizeof(int)));
+
     RRES_FREE(chunk.data.props);  // Resource chunk properties
     RRES_FREE(chunk.data.raw);    // Resource chunk raw data
 }
@@ -669,20 +950,25 @@ rresResourceMulti rresLoadResourceMulti(const char *fileName, unsigned int rresI
 {
     rresResourceMulti rres = { 0 };
 
+    RRES_TRACE_BEGIN(openSpan);
     FILE *rresFile = fopen(fileName, "rb");
 
     if (rresFile == NULL) RRES_LOG("RRES: WARNING: [%s] rres file could not be opened\n", fileName);
     else
     {
+        RRES_STATS_FILE(fileName);
+
         rresFileHeader header = { 0 };
 
         // Read rres file header
-        fread(&header, sizeof(rresFileHeader), 1, rresFile);
+        RRES_FREAD(&header, sizeof(rresFileHeader), 1, rresFile);
+        RRES_TRACE_END(RRES_TRACE_OPEN, rresId, NULL, openSpan);
 
         // Verify file signature: "rres" and file version: 100
         if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
         {
             bool found = false;
+            RRES_TRACE_BEGIN(indexSpan);
 
             // Check all available chunks looking for the requested id
             for (int i = 0; i < header.chunkCount; i++)
@@ -690,7 +976,7 @@ rresResourceMulti rresLoadResourceMulti(const char *fileName, unsigned int rresI
                 rresResourceChunkInfo info = { 0 };
 
                 // Read resource info header
-                fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
+                RRES_FREAD(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
 
                 // Check if resource id is the requested one
                 if (info.id == rresId)
@@ -708,44 +994,54 @@ rresResourceMulti rresLoadResourceMulti(const char *fileName, unsigned int rresI
                     // Count all linked resource chunks checking temp.nextOffset
                     while (temp.nextOffset != 0)
                     {
-                        fseek(rresFile, temp.nextOffset, SEEK_SET);         // Jump to next linked resource
-                        fread(&temp, sizeof(rresResourceChunkInfo), 1, rresFile); // Read next resource info header
+                        RRES_FSEEK(rresFile, temp.nextOffset, SEEK_SET);         // Jump to next linked resource
+                        RRES_FREAD(&temp, sizeof(rresResourceChunkInfo), 1, rresFile); // Read next resource info header
                         rres.count++;
                     }
 
                     rres.chunks = (rresResourceChunk *)RRES_CALLOC(rres.count, sizeof(rresResourceChunk)); // Load as many rres slots as required
-                    fseek(rresFile, currentFileOffset, SEEK_SET);           // Return to first resource chunk position
+                    RRES_STATS_RECORD(RRES_STATS_EVENT_ALLOC, 0, rres.count*sizeof(rresResourceChunk));
+                    RRES_FSEEK(rresFile, currentFileOffset, SEEK_SET);           // Return to first resource chunk position
+                    RRES_TRACE_END(RRES_TRACE_INDEX, rresId, info.type, indexSpan);
 
                     // Read and load data chunk from file data
                     // NOTE: Read data can be compressed/encrypted,
                     // it's up to the user library to manage decompression/decryption
+                    RRES_TRACE_BEGIN(readSpan);
                     void *data = RRES_CALLOC(info.packedSize, 1);           // Allocate enough memory to store resource data chunk
-                    fread(data, info.packedSize, 1, rresFile);              // Read data: propsCount + props[] + data (+additional_data)
+                    RRES_STATS_RECORD(RRES_STATS_EVENT_ALLOC, 0, info.packedSize);
+                    RRES_FREAD(data, info.packedSize, 1, rresFile);              // Read data: propsCount + props[] + data (+additional_data)
+                    RRES_TRACE_END(RRES_TRACE_READ, info.id, info.type, readSpan);
 
                     // Get chunk.data properly organized (only if uncompressed/unencrypted)
                     rres.chunks[0].data = rresLoadResourceChunkData(info, data);
                     rres.chunks[0].info = info;
 
                     RRES_FREE(data);
+                    RRES_STATS_RECORD(RRES_STATS_EVENT_FREE, 0, info.packedSize);
 
                     int i = 1;
 
                     // Load all linked resource chunks
                     while (info.nextOffset != 0)
                     {
-                        fseek(rresFile, info.nextOffset, SEEK_SET);         // Jump to next resource chunk
-                        fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile); // Read next resource info header
+                        RRES_TRACE_BEGIN(readSpan);
+                        RRES_FSEEK(rresFile, info.nextOffset, SEEK_SET);         // Jump to next resource chunk
+                        RRES_FREAD(&info, sizeof(rresResourceChunkInfo), 1, rresFile); // Read next resource info header
 
                         RRES_LOG("RRES: %c%c%c%c: Id: 0x%08x | Base size: %i | Packed size: %i\n", info.type[0], info.type[1], info.type[2], info.type[3], info.id, info.baseSize, info.packedSize);
 
                         void *data = RRES_CALLOC(info.packedSize, 1);       // Allocate enough memory to store resource data chunk
-                        fread(data, info.packedSize, 1, rresFile);          // Read data: propsCount + props[] + data (+additional_data)
+                        RRES_STATS_RECORD(RRES_STATS_EVENT_ALLOC, 0, info.packedSize);
+                        RRES_FREAD(data, info.packedSize, 1, rresFile);          // Read data: propsCount + props[] + data (+additional_data)
+                        RRES_TRACE_END(RRES_TRACE_READ, info.id, info.type, readSpan);
 
                         // Get chunk.data properly organized (only if uncompressed/unencrypted)
                         rres.chunks[i].data = rresLoadResourceChunkData(info, data);
                         rres.chunks[i].info = info;
 
                         RRES_FREE(data);
+                        RRES_STATS_RECORD(RRES_STATS_EVENT_FREE, 0, info.packedSize);
 
                         i++;
                     }
@@ -755,14 +1051,19 @@ rresResourceMulti rresLoadResourceMulti(const char *fileName, unsigned int rresI
                 else
                 {
                     // Skip required data size to read next resource info header
-                    fseek(rresFile, info.packedSize, SEEK_CUR);
+                    RRES_FSEEK(rresFile, info.packedSize, SEEK_CUR);
                 }
             }
 
-            if (!found) RRES_LOG("RRES: WARNING: Requested resource not found: 0x%08x\n", rresId);
+            if (!found)
+            {
+                RRES_TRACE_END(RRES_TRACE_INDEX, rresId, NULL, indexSpan);
+                RRES_LOG("RRES: WARNING: Requested resource not found: 0x%08x\n", rresId);
+            }
         }
         else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
 
+        RRES_STATS_FILE(NULL);
         fclose(rresFile);
     }
 
@@ -775,6 +1076,7 @@ void rresUnloadResourceMulti(rresResourceMulti multi)
     for (unsigned int i = 0; i < multi.count; i++) rresUnloadResourceChunk(multi.chunks[i]);
 
     RRES_FREE(multi.chunks);
+    RRES_STATS_RECORD(RRES_STATS_EVENT_FREE, 0, multi.count*sizeof(rresResourceChunk));
 }
 
 // Load resource chunk info for provided id
@@ -782,22 +1084,27 @@ RRESAPI rresResourceChunkInfo rresLoadResourceChunkInfo(const char *fileName, un
 {
     rresResourceChunkInfo info = { 0 };
 
+    RRES_TRACE_BEGIN(openSpan);
     FILE *rresFile = fopen(fileName, "rb");
 
     if (rresFile != NULL)
     {
+        RRES_STATS_FILE(fileName);
+
         rresFileHeader header = { 0 };
 
-        fread(&header, sizeof(rresFileHeader), 1, rresFile);
+        RRES_FREAD(&header, sizeof(rresFileHeader), 1, rresFile);
+        RRES_TRACE_END(RRES_TRACE_OPEN, rresId, NULL, openSpan);
 
         // Verify file signature: "rres", file version: 100
         if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
         {
             // Try to find provided resource chunk id and read info chunk
+            RRES_TRACE_BEGIN(indexSpan);
             for (int i = 0; i < header.chunkCount; i++)
             {
                 // Read resource chunk info
-                fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
+                RRES_FREAD(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
 
                 if (info.id == rresId)
                 {
@@ -806,11 +1113,14 @@ RRESAPI rresResourceChunkInfo rresLoadResourceChunkInfo(const char *fileName, un
 
                     break; // If requested rresId is found, return the read rresResourceChunkInfo
                 }
-                else fseek(rresFile, info.packedSize, SEEK_CUR); // Jump to next resource
+                else RRES_FSEEK(rresFile, info.packedSize, SEEK_CUR); // Jump to next resource
             }
+
+            RRES_TRACE_END(RRES_TRACE_INDEX, rresId, info.type, indexSpan);
         }
         else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
 
+        RRES_STATS_FILE(NULL);
         fclose(rresFile);
     }
 
@@ -823,31 +1133,40 @@ RRESAPI rresResourceChunkInfo *rresLoadResourceChunkInfoAll(const char *fileName
     rresResourceChunkInfo *infos = { 0 };
     unsigned int count = 0;
 
+    RRES_TRACE_BEGIN(openSpan);
     FILE *rresFile = fopen(fileName, "rb");
 
     if (rresFile != NULL)
     {
+        RRES_STATS_FILE(fileName);
+
         rresFileHeader header = { 0 };
 
-        fread(&header, sizeof(rresFileHeader), 1, rresFile);
+        RRES_FREAD(&header, sizeof(rresFileHeader), 1, rresFile);
+        RRES_TRACE_END(RRES_TRACE_OPEN, 0, NULL, openSpan);
 
         // Verify file signature: "rres", file version: 100
         if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
         {
             // Load all resource chunks info
+            RRES_TRACE_BEGIN(indexSpan);
             infos = (rresResourceChunkInfo *)RRES_CALLOC(header.chunkCount, sizeof(rresResourceChunkInfo));
+            RRES_STATS_RECORD(RRES_STATS_EVENT_ALLOC, 0, header.chunkCount*sizeof(rresResourceChunkInfo));
             count = header.chunkCount;
 
             for (unsigned int i = 0; i < count; i++)
             {
-                fread(&infos[i], sizeof(rresResourceChunkInfo), 1, rresFile); // Read resource chunk info
+                RRES_FREAD(&infos[i], sizeof(rresResourceChunkInfo), 1, rresFile); // Read resource chunk info
 
-                if (infos[i].nextOffset > 0) fseek(rresFile, infos[i].nextOffset, SEEK_SET); // Jump to next resource
-                else fseek(rresFile, infos[i].packedSize, SEEK_CUR); // Jump to next resource
+                if (infos[i].nextOffset > 0) RRES_FSEEK(rresFile, infos[i].nextOffset, SEEK_SET); // Jump to next resource
+                else RRES_FSEEK(rresFile, infos[i].packedSize, SEEK_CUR); // Jump to next resource
             }
+
+            RRES_TRACE_END(RRES_TRACE_INDEX, 0, NULL, indexSpan);
         }
         else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
 
+        RRES_STATS_FILE(NULL);
         fclose(rresFile);
     }
 
@@ -855,18 +1174,89 @@ RRESAPI rresResourceChunkInfo *rresLoadResourceChunkInfoAll(const char *fileName
     return infos;
 }
 
+// Read resource chunk packed data range from file
+// NOTE: Range is clamped to chunk packed data size, returns bytes read (0 if resource not found)
+unsigned int rresReadResourceChunkRange(const char *fileName, unsigned int rresId, unsigned int offset, unsigned int size, void *buffer)
+{
+    unsigned int readSize = 0;
+
+    RRES_TRACE_BEGIN(openSpan);
+    FILE *rresFile = fopen(fileName, "rb");
+
+    if (rresFile == NULL) RRES_LOG("RRES: WARNING: [%s] rres file could not be opened\n", fileName);
+    else
+    {
+        RRES_STATS_FILE(fileName);
+
+        rresFileHeader header = { 0 };
+
+        RRES_FREAD(&header, sizeof(rresFileHeader), 1, rresFile);
+        RRES_TRACE_END(RRES_TRACE_OPEN, rresId, NULL, openSpan);
+
+        // Verify file signature: "rres", file version: 100
+        if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
+        {
+            bool found = false;
+            RRES_TRACE_BEGIN(indexSpan);
+
+            for (int i = 0; i < header.chunkCount; i++)
+            {
+                rresResourceChunkInfo info = { 0 };
+
+                RRES_FREAD(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
+
+                if (info.id == rresId)
+                {
+                    found = true;
+                    RRES_TRACE_END(RRES_TRACE_INDEX, rresId, info.type, indexSpan);
+
+                    if (offset < info.packedSize)
+                    {
+                        if (size > (info.packedSize - offset)) size = info.packedSize - offset;
+
+                        // Read only requested data range, skipping previous chunk data
+                        RRES_TRACE_BEGIN(readSpan);
+                        if (offset > 0) RRES_FSEEK(rresFile, offset, SEEK_CUR);
+                        readSize = (unsigned int)RRES_FREAD(buffer, 1, size, rresFile);
+                        RRES_TRACE_END(RRES_TRACE_READ, info.id, info.type, readSpan);
+                    }
+
+                    break;
+                }
+                else RRES_FSEEK(rresFile, info.packedSize, SEEK_CUR); // Jump to next resource
+            }
+
+            if (!found)
+            {
+                RRES_TRACE_END(RRES_TRACE_INDEX, rresId, NULL, indexSpan);
+                RRES_LOG("RRES: WARNING: Requested resource not found: 0x%08x\n", rresId);
+            }
+        }
+        else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
+
+        RRES_STATS_FILE(NULL);
+        fclose(rresFile);
+    }
+
+    return readSize;
+}
+
 // Load central directory data
 rresCentralDir rresLoadCentralDirectory(const char *fileName)
 {
     rresCentralDir dir = { 0 };
 
+    RRES_TRACE_BEGIN(openSpan);
     FILE *rresFile = fopen(fileName, "rb");
 
     if (rresFile != NULL)
     {
+        RRES_STATS_FILE(fileName);
+
         rresFileHeader header = { 0 };
 
-        fread(&header, sizeof(rresFileHeader), 1, rresFile);
+        RRES_FREAD(&header, sizeof(rresFileHeader), 1, rresFile);
+        RRES_TRACE_END(RRES_TRACE_OPEN, 0, NULL, openSpan);
 
         // Verify file signature: "rres", file version: 100
         if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
@@ -877,20 +1267,24 @@ rresCentralDir rresLoadCentralDirectory(const char *fileName)
             {
                 rresResourceChunkInfo info = { 0 };
 
-                fseek(rresFile, header.cdOffset, SEEK_CUR); // Move to central directory position
-                fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile); // Read resource info
+                RRES_FSEEK(rresFile, header.cdOffset, SEEK_CUR); // Move to central directory position
+                RRES_FREAD(&info, sizeof(rresResourceChunkInfo), 1, rresFile); // Read resource info
 
                 // Verify resource type is CDIR
                 if ((info.type[0] == 'C') && (info.type[1] == 'D') && (info.type[2] == 'I') && (info.type[3] == 'R'))
                 {
                     RRES_LOG("RRES: CDIR: Central Directory found at offset: 0x%08x\n", header.cdOffset);
 
+                    RRES_TRACE_BEGIN(readSpan);
                     void *data = RRES_CALLOC(info.packedSize, 1);
-                    fread(data, info.packedSize, 1, rresFile);
+                    RRES_STATS_RECORD(RRES_STATS_EVENT_ALLOC, 0, info.packedSize);
+                    RRES_FREAD(data, info.packedSize, 1, rresFile);
+                    RRES_TRACE_END(RRES_TRACE_READ, info.id, info.type, readSpan);
 
                     // Load resource chunk data (central directory), data is uncompressed/unencrypted by default
                     rresResourceChunkData chunkData = rresLoadResourceChunkData(info, data);
                     RRES_FREE(data);
+                    RRES_STATS_RECORD(RRES_STATS_EVENT_FREE, 0, info.packedSize);
 
                     dir.count = chunkData.props[0];     // File entries count
 
@@ -898,6 +1292,7 @@ rresCentralDir rresLoadCentralDirectory(const char *fileName)
 
                     unsigned char *ptr = (unsigned char *)chunkData.raw;
                     dir.entries = (rresDirEntry *)RRES_CALLOC(dir.count, sizeof(rresDirEntry));
+                    RRES_STATS_RECORD(RRES_STATS_EVENT_ALLOC, 0, dir.count*sizeof(rresDirEntry));
 
                     for (unsigned int i = 0; i < dir.count; i++)
                     {
@@ -915,11 +1310,13 @@ rresCentralDir rresLoadCentralDirectory(const char *fileName)
 
                     RRES_FREE(chunkData.props);
                     RRES_FREE(chunkData.raw);
+                    RRES_STATS_RECORD(RRES_STATS_EVENT_FREE, 0, info.baseSize - sizeof(int));
                 }
             }
         }
         else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
 
+        RRES_STATS_FILE(NULL);
         fclose(rresFile);
     }
 
@@ -930,6 +1327,99 @@ rresCentralDir rresLoadCentralDirectory(const char *fileName)
 void rresUnloadCentralDirectory(rresCentralDir dir)
 {
     RRES_FREE(dir.entries);
+    RRES_STATS_RECORD(RRES_STATS_EVENT_FREE, 0, dir.count*sizeof(rresDirEntry));
+}
+
+// Prefetch resources data into system file cache for provided ids
+// NOTE 1: Files up to RRES_PREFETCH_FILE_MAX_SIZE (or any file if rresIds is NULL) are prefetched whole with a single
+// read-ahead hint, issued before any file data is read, chunks are not scanned and all file chunks are counted as prefetched
+// NOTE 2: Larger files are scanned to issue a read-ahead hint only for the requested chunks data ranges, the scan reads
+// every resource chunk info header synchronously (fread() + fseek() per chunk), on cold storage it can block before
+// any hint is issued; linked chunks (nextOffset) share the same id
+// NOTE 3: Returns the number of chunks prefetched, 0 if prefetch is not supported by the platform
+int rresPrefetch(const char *fileName, const unsigned int *rresIds, unsigned int count)
+{
+    int prefetchCount = 0;
+
+#if !defined(RRES_PREFETCH_FADVISE) && !defined(RRES_PREFETCH_RDADVISE)
+    RRES_LOG("RRES: WARNING: Resources prefetch not supported on this platform\n");
+    return prefetchCount;
+#endif
+
+    if ((rresIds != NULL) && (count == 0)) return prefetchCount;
+
+    FILE *rresFile = fopen(fileName, "rb");
+
+    if (rresFile == NULL) RRES_LOG("RRES: WARNING: [%s] rres file could not be opened\n", fileName);
+    else
+    {
+        RRES_STATS_FILE(fileName);
+
+        // Whole file is prefetched first (if required), hint is issued before reading file header
+        RRES_FSEEK(rresFile, 0, SEEK_END);
+        long fileSize = ftell(rresFile);
+        RRES_FSEEK(rresFile, 0, SEEK_SET);
+
+        bool wholeFile = (fileSize > 0) && ((rresIds == NULL) || (fileSize <= RRES_PREFETCH_FILE_MAX_SIZE));
+
+        if (wholeFile) rresPrefetchFileRange(rresFile, 0, fileSize);
+
+        rresFileHeader header = { 0 };
+
+        RRES_FREAD(&header, sizeof(rresFileHeader), 1, rresFile);
+
+        // Verify file signature: "rres", file version: 100
+        if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
+        {
+            if (wholeFile) prefetchCount = header.chunkCount;
+            else if (rresIds != NULL)
+            {
+                long rangeOffset = 0;       // Current data range to prefetch, contiguous chunks are merged
+                long rangeSize = 0;
+
+                for (int i = 0; i < header.chunkCount; i++)
+                {
+                    rresResourceChunkInfo info = { 0 };
+                    long chunkOffset = ftell(rresFile);
+
+                    if (RRES_FREAD(&info, sizeof(rresResourceChunkInfo), 1, rresFile) != 1) break;
+
+                    for (unsigned int k = 0; k < count; k++)
+                    {
+                        if (info.id == rresIds[k])
+                        {
+                            long chunkSize = (long)sizeof(rresResourceChunkInfo) + info.packedSize;
+
+                            // Merge with current range if contiguous, otherwise flush current range
+                            if ((rangeSize > 0) && ((rangeOffset + rangeSize) == chunkOffset)) rangeSize += chunkSize;
+                            else
+                            {
+                                if (rangeSize > 0) rresPrefetchFileRange(rresFile, rangeOffset, rangeSize);
+
+                                rangeOffset = chunkOffset;
+                                rangeSize = chunkSize;
+                            }
+
+                            prefetchCount++;
+                            break;
+                        }
+                    }
+
+                    RRES_FSEEK(rresFile, info.packedSize, SEEK_CUR);    // Jump to next resource
+                }
+
+                if (rangeSize > 0) rresPrefetchFileRange(rresFile, rangeOffset, rangeSize);
+            }
+
+            RRES_LOG("RRES: INFO: Resource chunks prefetched: %i%s\n", prefetchCount, wholeFile? " (whole file)" : "");
+        }
+        else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
+
+        RRES_STATS_FILE(NULL);
+        fclose(rresFile);
+    }
+
+    return prefetchCount;
 }
 
 // Get rresResourceDataType from FourCC code
@@ -949,6 +1439,7 @@ unsigned int rresGetDataType(const unsigned char *fourCC)
         else if (memcmp(fourCC, "FNTG", 4) == 0) type = RRES_DATA_FONT_GLYPHS;  // Font glyphs info, generated from an input font file
         else if (memcmp(fourCC, "LINK", 4) == 0) type = RRES_DATA_LINK;         // External linked file, filepath as provided on file input
         else if (memcmp(fourCC, "CDIR", 4) == 0) type = RRES_DATA_DIRECTORY;    // Central directory for input files relation to resource chunks
+        else if (memcmp(fourCC, "DICT", 4) == 0) type = RRES_DATA_DICTIONARY;   // Compression dictionary shared by resource chunks in the file
     }
 
     /*
@@ -1048,6 +1539,185 @@ const char *rresGetCipherPassword(void)
     return password;
 }
 
+// Get loading stats, global
+// NOTE: Stats are only recorded if RRES_SUPPORT_STATS is defined, zero-initialized stats returned otherwise
+rresStats rresGetStats(void)
+{
+    rresStats result = { 0 };
+
+#if defined(RRES_SUPPORT_STATS)
+    result = stats;
+#endif
+
+    return result;
+}
+
+// Get loading stats for a rres file
+// NOTE: Only the first RRES_STATS_MAX_FILES files processed are recorded individually
+rresStats rresGetFileStats(const char *fileName)
+{
+    rresStats result = { 0 };
+
+#if defined(RRES_SUPPORT_STATS)
+    if (fileName == NULL) return result;
+
+    unsigned int fileId = rresComputeCRC32((const unsigned char *)fileName, (int)strlen(fileName));
+
+    for (int i = 0; i < RRES_STATS_MAX_FILES; i++)
+    {
+        if (fileStats[i].used && (fileStats[i].fileId == fileId) && (strcmp(fileStats[i].fileName, fileName) == 0))
+        {
+            result = fileStats[i].stats;
+            break;
+        }
+    }
+#else
+    (void)fileName;                     // Stats not supported
+#endif
+
+    return result;
+}
+
+// Reset loading stats, global and per file
+// NOTE: Memory currently in use is kept to compute later usage properly
+void rresResetStats(void)
+{
+#if defined(RRES_SUPPORT_STATS)
+    unsigned long long usedBytes = stats.usedBytes;
+
+    memset(&stats, 0, sizeof(rresStats));
+    stats.usedBytes = usedBytes;
+    stats.peakBytes = usedBytes;
+
+    for (int i = 0; i < RRES_STATS_MAX_FILES; i++) RRES_FREE(fileStats[i].fileName);
+    memset(fileStats, 0, RRES_STATS_MAX_FILES*sizeof(rresFileStats));
+    currentFileStats = NULL;
+#endif
+}
+
+// Record loading stats event (rresStatsEvent)
+// NOTE: Event is recorded globally and also for the file currently processed (if any)
+void rresRecordStats(int event, unsigned int type, unsigned long long bytes, unsigned long long time)
+{
+#if defined(RRES_SUPPORT_STATS)
+    rresAddStats(&stats, event, type, bytes, time);
+    if (currentFileStats != NULL) rresAddStats(currentFileStats, event, type, bytes, time);
+#else
+    (void)event; (void)type; (void)bytes; (void)time;   // Stats not supported
+#endif
+}
+
+// Get current monotonic time in nanoseconds
+// NOTE: Always available, also used to measure data decompression on packing (rres-raylib.h)
+unsigned long long rresGetTimeNs(void)
+{
+    unsigned long long time = 0;
+
+#if defined(_WIN32)
+    PerformanceCounter frequency = { 0 };
+    PerformanceCounter counter = { 0 };
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    time = (unsigned long long)((double)counter.QuadPart*1000000000.0/(double)frequency.QuadPart);
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    time = (unsigned long long)now.tv_sec*1000000000ULL + (unsigned long long)now.tv_nsec;
+#else
+    // NOTE: Fallback if CLOCK_MONOTONIC is not available (POSIX definitions not enabled),
+    // wall-clock time is used (processor time would add the time of all threads)
+    struct timeval now = { 0 };
+    gettimeofday(&now, NULL);
+    time = (unsigned long long)now.tv_sec*1000000000ULL + (unsigned long long)now.tv_usec*1000ULL;
+#endif
+
+    return time;
+}
+
+// Set trace callback to receive loading spans, NULL to disable it
+void rresSetTraceCallback(rresTraceCallback callback, void *userData)
+{
+#if defined(RRES_SUPPORT_TRACE)
+    traceCallback = callback;
+    traceUserData = userData;
+#else
+    (void)callback; (void)userData;     // Trace not supported
+#endif
+}
+
+// Begin writing loading spans to trace file
+// NOTE: Chrome trace event format (JSON) is used, spans are written as complete events ("ph":"X")
+int rresBeginTraceFile(const char *fileName)
+{
+    int result = 0;
+
+#if defined(RRES_SUPPORT_TRACE)
+    if (traceFile != NULL) rresEndTraceFile();
+
+    traceFile = fopen(fileName, "wt");
+
+    if (traceFile == NULL) RRES_LOG("RRES: WARNING: [%s] Trace file could not be opened\n", fileName);
+    else
+    {
+        fprintf(traceFile, "{\"traceEvents\":[\n");
+        result = 1;
+    }
+#else
+    (void)fileName;                     // Trace not supported
+#endif
+
+    return result;
+}
+
+// End writing loading spans to trace file
+void rresEndTraceFile(void)
+{
+#if defined(RRES_SUPPORT_TRACE)
+    if (traceFile != NULL)
+    {
+        // NOTE: Every span is written followed by a comma, a metadata event closes the events list
+        fprintf(traceFile, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"rres\"}}\n]}\n");
+        fclose(traceFile);
+        traceFile = NULL;
+    }
+#endif
+}
+
+// Record loading trace span (rresTraceStage)
+// NOTE: Span is provided to trace callback and written to trace file, if available
+void rresRecordTraceSpan(int stage, unsigned int rresId, const unsigned char *type, unsigned long long start, unsigned long long end)
+{
+#if defined(RRES_SUPPORT_TRACE)
+    static const char *stageNames[] = { "open", "index", "read", "crc", "decrypt", "decompress", "convert" };
+
+    if ((traceCallback == NULL) && (traceFile == NULL)) return;
+
+    rresTraceSpan span = { 0 };
+    span.stage = stage;
+    span.threadId = rresGetThreadId();
+    span.rresId = rresId;
+    if (type != NULL) memcpy(span.type, type, 4);
+    span.start = start;
+    span.duration = end - start;
+
+    if (traceCallback != NULL) traceCallback(&span, traceUserData);
+
+    if (traceFile != NULL)
+    {
+        // Make sure FourCC can be written as a JSON string
+        char fourCC[5] = { 0 };
+        for (int i = 0; i < 4; i++) fourCC[i] = ((span.type[i] >= 32) && (span.type[i] < 127) && (span.type[i] != '"') && (span.type[i] != '\\'))? (char)span.type[i] : ' ';
+
+        // NOTE: Chrome trace timestamps are in microseconds
+        fprintf(traceFile, "{\"name\":\"%s\",\"cat\":\"rres\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"id\":\"0x%08x\",\"type\":\"%s\"}},\n",
+            ((stage >= RRES_TRACE_OPEN) && (stage <= RRES_TRACE_CONVERT))? stageNames[stage] : "unknown", span.threadId,
+            (double)span.start/1000.0, (double)span.duration/1000.0, span.rresId, fourCC);
+    }
+#else
+    (void)stage; (void)rresId; (void)type; (void)start; (void)end;     // Trace not supported
+#endif
+}
+
 //----------------------------------------------------------------------------------
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
@@ -1059,7 +1729,11 @@ static rresResourceChunkData rresLoadResourceChunkData(rresResourceChunkInfo inf
     rresResourceChunkData chunkData = { 0 };
 
     // CRC32 data validation, verify packed data is not corrupted
+    RRES_STATS_BEGIN(crcTimer);
+    RRES_TRACE_BEGIN(crcSpan);
     unsigned int crc32 = rresComputeCRC32((const unsigned char *)data, info.packedSize);
+    RRES_TRACE_END(RRES_TRACE_CRC, info.id, info.type, crcSpan);
+    RRES_STATS_END(RRES_STATS_EVENT_CRC, 0, crcTimer);
 
     if ((rresGetDataType(info.type) != RRES_DATA_NULL) && (crc32 == info.crc32))   // Make sure chunk contains data and data is not corrupted
     {
@@ -1077,6 +1751,7 @@ static rresResourceChunkData rresLoadResourceChunkData(rresResourceChunkInfo inf
 
             int rawSize = info.baseSize - sizeof(int) - (chunkData.propCount*sizeof(int));
             chunkData.raw = RRES_CALLOC(rawSize, 1);
+            RRES_STATS_RECORD(RRES_STATS_EVENT_ALLOC, 0, info.baseSize - sizeof(int));   // props[] + data
             if (chunkData.raw != NULL) memcpy(chunkData.raw, ((unsigned char *)data) + sizeof(int) + (chunkData.propCount*sizeof(int)), rawSize);
         }
         else
@@ -1085,6 +1760,7 @@ static rresResourceChunkData rresLoadResourceChunkData(rresResourceChunkInfo inf
             // Just return the loaded resource packed data from .rres file,
             // it's up to the user to manage decompression/decryption on user library
             chunkData.raw = RRES_CALLOC(info.packedSize, 1);
+            RRES_STATS_RECORD(RRES_STATS_EVENT_ALLOC, 0, info.packedSize);
             if (chunkData.raw != NULL) memcpy(chunkData.raw, (unsigned char *)data, info.packedSize);
         }
     }
@@ -1094,4 +1770,151 @@ static rresResourceChunkData rresLoadResourceChunkData(rresResourceChunkInfo inf
     return chunkData;
 }
 
+// Issue a read-ahead hint to the OS for a file data range
+// NOTE: Hint is asynchronous, data is read into the system file cache in background
+static void rresPrefetchFileRange(FILE *file, long offset, long size)
+{
+#if defined(RRES_PREFETCH_FADVISE)
+    if (posix_fadvise(fileno(file), (off_t)offset, (off_t)size, POSIX_FADV_WILLNEED) != 0) RRES_LOG("RRES: WARNING: File range could not be prefetched\n");
+#elif defined(RRES_PREFETCH_RDADVISE)
+    struct radvisory advisory = { 0 };
+    advisory.ra_offset = (off_t)offset;
+    advisory.ra_count = (int)size;
+    if (fcntl(fileno(file), F_RDADVISE, &advisory) == -1) RRES_LOG("RRES: WARNING: File range could not be prefetched\n");
+#else
+    (void)file; (void)offset; (void)size;   // File cache hints not available
+#endif
+}
+
+#if defined(RRES_SUPPORT_STATS)
+// Read data from file, recording stats
+static size_t rresReadFile(void *buffer, size_t size, size_t count, FILE *file)
+{
+    unsigned long long time = rresGetTimeNs();
+    size_t result = fread(buffer, size, count, file);
+
+    rresRecordStats(RRES_STATS_EVENT_READ, 0, result*size, rresGetTimeNs() - time);
+
+    return result;
+}
+
+// Seek file position, recording stats
+static int rresSeekFile(FILE *file, long offset, int origin)
+{
+    unsigned long long time = rresGetTimeNs();
+    int result = fseek(file, offset, origin);
+
+    rresRecordStats(RRES_STATS_EVENT_SEEK, 0, 0, rresGetTimeNs() - time);
+
+    return result;
+}
+
+// Set file to record loading stats, NULL to stop recording file stats
+// NOTE 1: A stats slot is assigned to every new file, once all slots are used new files are not recorded individually
+// NOTE 2: Files are identified by fileName CRC32 hash, fileName is compared on hash match (different files could collide)
+static void rresSetStatsFile(const char *fileName)
+{
+    currentFileStats = NULL;
+
+    if (fileName != NULL)
+    {
+        size_t length = strlen(fileName);
+        unsigned int fileId = rresComputeCRC32((const unsigned char *)fileName, (int)length);
+
+        for (int i = 0; i < RRES_STATS_MAX_FILES; i++)
+        {
+            if (!fileStats[i].used)
+            {
+                // New file, slot is assigned only if fileName can be copied
+                fileStats[i].fileName = (char *)RRES_MALLOC(length + 1);
+
+                if (fileStats[i].fileName != NULL)
+                {
+                    memcpy(fileStats[i].fileName, fileName, length + 1);
+                    fileStats[i].fileId = fileId;
+                    fileStats[i].used = true;
+                    currentFileStats = &fileStats[i].stats;
+                }
+                break;
+            }
+            else if ((fileStats[i].fileId == fileId) && (strcmp(fileStats[i].fileName, fileName) == 0))
+            {
+                currentFileStats = &fileStats[i].stats;
+                break;
+            }
+        }
+    }
+}
+
+// Add event to stats
+static void rresAddStats(rresStats *st, int event, unsigned int type, unsigned long long bytes, unsigned long long time)
+{
+    switch (event)
+    {
+        case RRES_STATS_EVENT_READ:
+        {
+            st->readCount++;
+            st->readBytes += bytes;
+            st->readTime += time;
+        } break;
+        case RRES_STATS_EVENT_SEEK:
+        {
+            st->seekCount++;
+            st->seekTime += time;
+        } break;
+        case RRES_STATS_EVENT_CRC:
+        {
+            st->crcCount++;
+            st->crcTime += time;
+        } break;
+        case RRES_STATS_EVENT_KEY:
+        {
+            st->keyCount++;
+            st->keyTime += time;
+        } break;
+        case RRES_STATS_EVENT_DECRYPT:
+        {
+            st->decryptCount[type & 0xff]++;
+            st->decryptTime[type & 0xff] += time;
+        } break;
+        case RRES_STATS_EVENT_DECOMPRESS:
+        {
+            st->decompressCount[type & 0xff]++;
+            st->decompressTime[type & 0xff] += time;
+        } break;
+        case RRES_STATS_EVENT_ALLOC:
+        {
+            st->allocCount++;
+            st->allocBytes += bytes;
+            st->usedBytes += bytes;
+            if (st->usedBytes > st->peakBytes) st->peakBytes = st->usedBytes;
+        } break;
+        case RRES_STATS_EVENT_FREE:
+        {
+            // NOTE: Memory allocated before a stats reset could be freed later
+            st->usedBytes = (bytes > st->usedBytes)? 0 : (st->usedBytes - bytes);
+        } break;
+        default: break;
+    }
+}
+#endif
+
+#if defined(RRES_SUPPORT_TRACE)
+// Get current thread id
+// NOTE: On POSIX systems pthread_t value is folded to 32 bit, it's only used to identify threads in trace spans
+static unsigned int rresGetThreadId(void)
+{
+    unsigned int id = 0;
+
+#if defined(_WIN32)
+    id = (unsigned int)GetCurrentThreadId();
+#else
+    unsigned long long thread = (unsigned long long)(unsigned long)pthread_self();
+    id = (unsigned int)(thread ^ (thread >> 32));
+#endif
+
+    return id;
+}
+#endif
+
 #endif // RRES_IMPLEMENTATION